@@ -0,0 +1,11 @@
+precision mediump float;
+
+uniform sampler2D colorTexture;
+uniform sampler2D alphaTexture;
+
+varying vec2 vVertTexCoords;
+
+void main()
+{
+    gl_FragColor = vec4(texture2D(colorTexture, vVertTexCoords).rgb, texture2D(alphaTexture, vVertTexCoords).g);
+}
\ No newline at end of file
@@ -1,8 +1,8 @@
-precision mediump float;
-
-varying vec4 vVertColor;
-
-void main() 
-{
-    gl_FragColor = vVertColor;
+precision mediump float;
+
+varying vec4 vVertColor;
+
+void main() 
+{
+    gl_FragColor = vVertColor;
 }
\ No newline at end of file
@@ -1,12 +1,13 @@
-attribute vec4 vPosition;
-attribute vec4 vColor;
-
-uniform mat4 mModelProjectionMatrix;
-
-varying vec4 vVertColor;
-
-void main() 
-{
-    vVertColor = vColor;
-    gl_Position = mModelProjectionMatrix * vPosition;
-}
+attribute vec4 vPosition;
+attribute vec4 vColor;
+
+uniform vec3 mModelProjectionRows[2];
+
+varying vec4 vVertColor;
+
+void main() 
+{
+    vVertColor = vColor;
+    vec3 position = vec3(vPosition.xy, 1.0);
+    gl_Position = vec4(dot(mModelProjectionRows[0], position), dot(mModelProjectionRows[1], position), 0.0, 1.0);
+}
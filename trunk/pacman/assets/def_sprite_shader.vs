@@ -0,0 +1,15 @@
+attribute vec4 vPosition;
+attribute vec2 vTexCoords;
+
+uniform vec3 mModelProjectionRows[2]; // rows of the 2D affine model-projection transform
+uniform vec4 mSpriteRect;    // x, y, width, height of the sprite
+uniform vec4 mTextureRegion; // u, v, width, height of the texture region
+varying vec2 vVertTexCoords;
+
+// vertices are the corners of the unit quad
+void main()
+{
+	vec3 position = vec3(mSpriteRect.xy + vPosition.xy * mSpriteRect.zw, 1.0);
+	gl_Position = vec4(dot(mModelProjectionRows[0], position), dot(mModelProjectionRows[1], position), 0.0, 1.0);
+	vVertTexCoords = mTextureRegion.xy + vTexCoords * mTextureRegion.zw;
+}
\ No newline at end of file
@@ -1,10 +1,10 @@
-attribute vec4 vPosition;
-attribute vec2 vTexCoords;
-
-varying vec2 vVertTexCoords;
-
-void main()
-{
-    gl_Position = vPosition;
-    vVertTexCoords = vTexCoords;
+attribute vec4 vPosition;
+attribute vec2 vTexCoords;
+
+varying vec2 vVertTexCoords;
+
+void main()
+{
+    gl_Position = vPosition;
+    vVertTexCoords = vTexCoords;
 }
\ No newline at end of file
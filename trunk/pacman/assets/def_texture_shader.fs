@@ -1,10 +1,10 @@
-precision mediump float;
-
-uniform sampler2D colorTexture;
-
-varying vec2 vVertTexCoords;
-
-void main()
-{
-    gl_FragColor = texture2D(colorTexture, vVertTexCoords);
+precision mediump float;
+
+uniform sampler2D colorTexture;
+
+varying vec2 vVertTexCoords;
+
+void main()
+{
+    gl_FragColor = texture2D(colorTexture, vVertTexCoords);
 }
\ No newline at end of file
@@ -1,11 +1,12 @@
-attribute vec4 vPosition;
-attribute vec2 vTexCoords;
-
-uniform mat4 mModelProjectionMatrix;
-varying vec2 vVertTexCoords;
-
-void main()
-{
-	gl_Position = mModelProjectionMatrix * vPosition;
-	vVertTexCoords = vTexCoords;
+attribute vec4 vPosition;
+attribute vec2 vTexCoords;
+
+uniform vec3 mModelProjectionRows[2];
+varying vec2 vVertTexCoords;
+
+void main()
+{
+	vec3 position = vec3(vPosition.xy, 1.0);
+	gl_Position = vec4(dot(mModelProjectionRows[0], position), dot(mModelProjectionRows[1], position), 0.0, 1.0);
+	vVertTexCoords = vTexCoords;
 }
\ No newline at end of file
@@ -6,11 +6,17 @@ LOCAL_MODULE    := nativelib
 LOCAL_CFLAGS    := -Werror -std=gnu++0x -Wno-psabi -fexceptions -frtti
 LOCAL_SRC_FILES := main.cpp\
                    renderer.cpp\
+                   render_stats.cpp\
+                   gl_wrapper.cpp\
+                   render_queue.cpp\
+                   sprite_batch.cpp\
+                   static_layer_cache.cpp\
                    sprite.cpp\
                    instanced_sprite.cpp\
                    spritesheet.cpp\
                    color.cpp\
                    vertex_buffer.cpp\
+                   vertex_layout_cache.cpp\
                    error.cpp\
                    shader.cpp\
                    shader_program.cpp\
@@ -18,7 +24,10 @@ LOCAL_SRC_FILES := main.cpp\
                    asset_manager.cpp\
                    scene_node.cpp\
                    scene_manager.cpp\
+                   simulation_thread.cpp\
                    timer.cpp\
+                   profiler.cpp\
+                   allocation_tracker.cpp\
                    frame_animator.cpp\
                    jni_utility.cpp\
                    json_helper.cpp\
@@ -33,6 +42,8 @@ LOCAL_SRC_FILES := main.cpp\
 				   game/common.cpp\
 				   game/actor.cpp\
 				   game/map.cpp\
+				   game/nav_graph.cpp\
+				   game/distance_field.cpp\
 				   game/dots_grid.cpp\
 				   game/scheduler.cpp\
 				   game/ghost.cpp\
@@ -40,6 +51,6 @@ LOCAL_SRC_FILES := main.cpp\
 				   game/pacman_controller.cpp\
 				   game/ai_controller.cpp\
 				   game/shared_data_manager.cpp
-LOCAL_LDLIBS    := -llog -lGLESv2 -ljnigraphics
+LOCAL_LDLIBS    := -llog -lGLESv2 -lEGL -ljnigraphics
 
 include $(BUILD_SHARED_LIBRARY)
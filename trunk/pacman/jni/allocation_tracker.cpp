@@ -0,0 +1,232 @@
+#include "allocation_tracker.h"
+
+#include <pthread.h>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "log.h"
+
+namespace Pacman {
+
+struct ScopeData
+{
+    std::atomic<const char*> mName;
+    std::atomic<uint64_t>    mCount;
+    std::atomic<uint64_t>    mBytes;
+};
+
+// zero initialized, operator new can be called before the dynamic initialization
+static std::atomic<uint64_t> gTotalCount;
+static std::atomic<uint64_t> gTotalBytes;
+static std::atomic<uint64_t> gFrameCount;
+static std::atomic<uint64_t> gFrameBytes;
+static ScopeData gScopes[AllocationTracker::kMaxScopesCount];
+
+static pthread_once_t gScopeKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t gScopeKey; // the current ScopeData of the thread
+
+static void CreateScopeKey()
+{
+    pthread_key_create(&gScopeKey, nullptr);
+}
+
+static FORCEINLINE ScopeData* GetCurrentScope()
+{
+    pthread_once(&gScopeKeyOnce, &CreateScopeKey);
+    return static_cast<ScopeData*>(pthread_getspecific(gScopeKey));
+}
+
+// the scope is identified by the pointer of its name
+static ScopeData* FindScope(const char* name)
+{
+    for (ScopeData& scope : gScopes)
+    {
+        const char* scopeName = scope.mName.load(std::memory_order_acquire);
+        if (scopeName == nullptr)
+        {
+            if (scope.mName.compare_exchange_strong(scopeName, name) || (scopeName == name))
+                return &scope;
+        }
+        else if (scopeName == name)
+        {
+            return &scope;
+        }
+    }
+
+    // the table is full, the allocations are counted by the enclosing scope
+    return nullptr;
+}
+
+static FORCEINLINE AllocationCounters MakeCounters(const uint64_t count, const uint64_t bytes)
+{
+    const AllocationCounters counters = { count, bytes };
+    return counters;
+}
+
+const size_t AllocationTracker::kMaxScopesCount;
+
+AllocationCounters AllocationTracker::GetTotalCounters()
+{
+    return MakeCounters(gTotalCount.load(), gTotalBytes.load());
+}
+
+AllocationCounters AllocationTracker::GetFrameCounters()
+{
+    return MakeCounters(gFrameCount.load(), gFrameBytes.load());
+}
+
+AllocationCounters AllocationTracker::EndFrame()
+{
+    return MakeCounters(gFrameCount.exchange(0), gFrameBytes.exchange(0));
+}
+
+size_t AllocationTracker::GetScopesAllocations(ScopeAllocations* scopes, const size_t maxCount)
+{
+    size_t count = 0;
+    for (size_t i = 0; (i < kMaxScopesCount) && (count < maxCount); i++)
+    {
+        const ScopeData& scope = gScopes[i];
+        const char* name = scope.mName.load(std::memory_order_acquire);
+        if ((name == nullptr) || (scope.mCount.load() == 0))
+            continue;
+
+        scopes[count].mName = name;
+        scopes[count].mCounters = MakeCounters(scope.mCount.load(), scope.mBytes.load());
+        count++;
+    }
+
+    return count;
+}
+
+std::string AllocationTracker::ToString()
+{
+    char buffer[256];
+    const AllocationCounters total = GetTotalCounters();
+    const AllocationCounters frame = GetFrameCounters();
+
+    snprintf(buffer, sizeof(buffer), "Allocations: total %llu (%llu bytes), frame %llu (%llu bytes)\n",
+             static_cast<unsigned long long>(total.mCount), static_cast<unsigned long long>(total.mBytes),
+             static_cast<unsigned long long>(frame.mCount), static_cast<unsigned long long>(frame.mBytes));
+    std::string result = buffer;
+
+    ScopeAllocations scopes[kMaxScopesCount];
+    const size_t scopesCount = GetScopesAllocations(scopes, kMaxScopesCount);
+    for (size_t i = 0; i < scopesCount; i++)
+    {
+        snprintf(buffer, sizeof(buffer), "    %s: %llu (%llu bytes)\n", scopes[i].mName,
+                 static_cast<unsigned long long>(scopes[i].mCounters.mCount),
+                 static_cast<unsigned long long>(scopes[i].mCounters.mBytes));
+        result += buffer;
+    }
+
+    return result;
+}
+
+void AllocationTracker::Log()
+{
+    // line by line, the logging itself shouldn't allocate
+    const AllocationCounters total = GetTotalCounters();
+    const AllocationCounters frame = GetFrameCounters();
+    LogI("Allocations: total %llu (%llu bytes), frame %llu (%llu bytes)",
+         static_cast<unsigned long long>(total.mCount), static_cast<unsigned long long>(total.mBytes),
+         static_cast<unsigned long long>(frame.mCount), static_cast<unsigned long long>(frame.mBytes));
+
+    ScopeAllocations scopes[kMaxScopesCount];
+    const size_t scopesCount = GetScopesAllocations(scopes, kMaxScopesCount);
+    for (size_t i = 0; i < scopesCount; i++)
+    {
+        LogI("    %s: %llu (%llu bytes)", scopes[i].mName,
+             static_cast<unsigned long long>(scopes[i].mCounters.mCount),
+             static_cast<unsigned long long>(scopes[i].mCounters.mBytes));
+    }
+}
+
+void AllocationTracker::OnAllocation(const size_t size)
+{
+    gTotalCount.fetch_add(1, std::memory_order_relaxed);
+    gTotalBytes.fetch_add(size, std::memory_order_relaxed);
+    gFrameCount.fetch_add(1, std::memory_order_relaxed);
+    gFrameBytes.fetch_add(size, std::memory_order_relaxed);
+
+    ScopeData* scope = GetCurrentScope();
+    if (scope != nullptr)
+    {
+        scope->mCount.fetch_add(1, std::memory_order_relaxed);
+        scope->mBytes.fetch_add(size, std::memory_order_relaxed);
+    }
+}
+
+const void* AllocationTracker::EnterScope(const char* name)
+{
+    ScopeData* previousScope = GetCurrentScope();
+    ScopeData* scope = FindScope(name);
+    if (scope != nullptr)
+        pthread_setspecific(gScopeKey, scope);
+
+    return previousScope;
+}
+
+void AllocationTracker::LeaveScope(const void* previousScope)
+{
+    pthread_setspecific(gScopeKey, previousScope);
+}
+
+} // Pacman namespace
+
+#ifdef PACMAN_ALLOCATION_TRACKING
+
+// the replaced global allocation functions
+
+static FORCEINLINE void* TrackedAllocate(const size_t size)
+{
+    Pacman::AllocationTracker::OnAllocation(size);
+    return std::malloc((size > 0) ? size : 1);
+}
+
+void* operator new(const size_t size)
+{
+    void* ptr = TrackedAllocate(size);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+
+    return ptr;
+}
+
+void* operator new[](const size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(const size_t size, const std::nothrow_t&) noexcept
+{
+    return TrackedAllocate(size);
+}
+
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept
+{
+    return TrackedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+#endif
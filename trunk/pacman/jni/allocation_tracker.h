@@ -0,0 +1,88 @@
+#pragma once
+
+#include <string>
+
+#include "base.h"
+
+namespace Pacman {
+
+#ifdef PACMAN_ALLOCATION_TRACKING
+    #define PACMAN_ALLOCATION_CONCAT_IMPL(a, b) a##b
+    #define PACMAN_ALLOCATION_CONCAT(a, b) PACMAN_ALLOCATION_CONCAT_IMPL(a, b)
+
+    // name - string literal, the allocations are counted by the innermost scope of the thread
+    #define PACMAN_ALLOCATION_SCOPE(name)\
+        const AllocationScope PACMAN_ALLOCATION_CONCAT(allocationScope, __LINE__)(name);
+#else
+    #define PACMAN_ALLOCATION_SCOPE(name)
+#endif
+
+struct AllocationCounters
+{
+    uint64_t mCount;
+    uint64_t mBytes;
+};
+
+struct ScopeAllocations
+{
+    const char*        mName;
+    AllocationCounters mCounters;
+};
+
+// counts the global operator new calls of all the threads (PACMAN_ALLOCATION_TRACKING),
+// the steady state frames shouldn't allocate at all
+struct AllocationTracker
+{
+    static const size_t kMaxScopesCount = 32;
+
+    // since the start
+    static AllocationCounters GetTotalCounters();
+
+    // since the last EndFrame
+    static AllocationCounters GetFrameCounters();
+
+    // returns the counters of the finished frame
+    static AllocationCounters EndFrame();
+
+    // the scopes which have allocated, returns the count of the filled elements
+    static size_t GetScopesAllocations(ScopeAllocations* scopes, const size_t maxCount);
+
+    static std::string ToString();
+
+    static void Log();
+
+    // the allocation hook, called by operator new
+    static void OnAllocation(const size_t size);
+
+    // name - string literal, returns the previous scope of the thread
+    static const void* EnterScope(const char* name);
+
+    static void LeaveScope(const void* previousScope);
+};
+
+class AllocationScope
+{
+public:
+
+    AllocationScope() = delete;
+
+    FORCEINLINE explicit AllocationScope(const char* name)
+        : mPreviousScope(AllocationTracker::EnterScope(name))
+    {
+    }
+
+    AllocationScope(const AllocationScope&) = delete;
+
+    FORCEINLINE ~AllocationScope()
+    {
+        AllocationTracker::LeaveScope(mPreviousScope);
+    }
+
+    AllocationScope& operator= (const AllocationScope&) = delete;
+
+private:
+
+    const void* mPreviousScope;
+};
+
+} // Pacman namespace
@@ -1,231 +1,456 @@
-#include "asset_manager.h"
-
-#include <new>
-#include <algorithm>
-#include <memory>
-#include <android/bitmap.h>
-
-#include "engine.h"
-#include "error.h"
-#include "color.h"
-#include "texture.h"
-#include "shader_program.h"
-#include "spritesheet.h"
-#include "jni_utility.h"
-#include "json_helper.h"
-#include "utils.h"
-
-namespace Pacman {
-
-const std::string AssetManager::kDefaultColorVertexShader         = "def_color_shader.vs";
-const std::string AssetManager::kDefaultStaticColorVertexShader   = "def_static_color_shader.vs";
-const std::string AssetManager::kDefaultColorFragmentShader       = "def_color_shader.fs";
-const std::string AssetManager::kDefaultTextureVertexShader       = "def_texture_shader.vs";
-const std::string AssetManager::kDefaultStaticTextureVertexShader = "def_static_texture_shader.vs";
-const std::string AssetManager::kDefaultTextureFragmentShader     = "def_texture_shader.fs";
-
-class AndroidBitmapHolder
-{
-public:
-
-	AndroidBitmapHolder() = delete;
-	AndroidBitmapHolder(JNIEnv* env, jobject bitmap)
-		: mEnv(env), mBitmap(bitmap), mIsLocked(false)
-	{
-	}
-
-	AndroidBitmapHolder(const AndroidBitmapHolder&) = delete;
-    AndroidBitmapHolder(AndroidBitmapHolder&&) = delete;
-	~AndroidBitmapHolder()
-	{
-		UnlockPixels();
-	}
-
-	AndroidBitmapHolder& operator= (const AndroidBitmapHolder&) = delete;
-	void* operator new (size_t) throw (std::bad_alloc) = delete;
-	void* operator new (size_t, const std::nothrow_t&) throw() = delete;
-	void* operator new[] (size_t) throw (std::bad_alloc) = delete;
-	void* operator new[] (size_t, const std::nothrow_t&) throw() = delete;
-
-	AndroidBitmapInfo GetInfo() const
-	{
-		AndroidBitmapInfo info;
-		int res = AndroidBitmap_getInfo(mEnv, mBitmap, &info);
-		PACMAN_CHECK_ERROR(res == ANDROID_BITMAP_RESUT_SUCCESS);
-		return info;
-	}
-
-	const byte_t* LockPixels()
-	{
-		void* pixels = nullptr;
-		int res = AndroidBitmap_lockPixels(mEnv, mBitmap, &pixels);
-		PACMAN_CHECK_ERROR(res == ANDROID_BITMAP_RESUT_SUCCESS);
-		mIsLocked = true;
-		return static_cast<const byte_t*>(pixels);
-	}
-
-	void UnlockPixels()
-	{
-		if (mIsLocked)
-		{
-			AndroidBitmap_unlockPixels(mEnv, mBitmap);
-			mIsLocked = false;
-		}
-	}
-
-private:
-
-	JNIEnv* mEnv;
-	jobject mBitmap;
-	bool 	mIsLocked;
-};
-
-std::string ApplyMultiplier(const std::string& name, const size_t multiplier)
-{
-	std::ostringstream result;
-	const size_t dotPos = name.find_last_of('.');
-	PACMAN_CHECK_ERROR((dotPos != std::string::npos) && (dotPos < name.size()));
-
-    return MakeString(name.substr(0, dotPos),                      // add name
-                      "@", multiplier,                             // add multiplier
-                      "x.", name.substr(dotPos + 1, name.size())); // add extension
-}
-
-jobject LoadBitmapFromAssets(const std::string& name)
-{
-	jstring assetName = JNI::MakeUTF8String(name.c_str());
-	return JNI::CallStaticObjectMethod("com/imdex/pacman/NativeLib", "loadAssetBitmap",
-									   "(Ljava/lang/String;)Landroid/graphics/Bitmap;", assetName);
-}
-
-jobject LoadFileFromAssets(const std::string& name)
-{
-	jstring assetName = JNI::MakeUTF8String(name.c_str());
-	return JNI::CallStaticObjectMethod("com/imdex/pacman/NativeLib", "loadAssetFile",
-									   "(Ljava/lang/String;)Ljava/nio/ByteBuffer;", assetName);
-}
-
-//=================================================================================================================
-
-std::shared_ptr<Texture2D> AssetManager::LoadTexture(const std::string& name, const TextureFiltering filtering,
-									 	 	 	     const TextureRepeat repeat)
-{
-	JNIEnv* env = JNI::GetEnv();
-
-	const std::string finalName = (mMultiplier > 0) ? ApplyMultiplier(name, mMultiplier)
-                                                    : name;
-
-	jobject bitmap = LoadBitmapFromAssets(finalName); // try to load bitmap with multiplier
-	if ((bitmap == nullptr) && (mMultiplier > 0))
-		bitmap = LoadBitmapFromAssets(name); // after try base
-	PACMAN_CHECK_ERROR(bitmap != nullptr);
-
-	AndroidBitmapHolder bitmapHolder(env, bitmap);
-	const AndroidBitmapInfo info = bitmapHolder.GetInfo();
-
-	PixelFormat pixelFormat = PixelFormat::None;
-	switch (info.format)
-	{
-	case ANDROID_BITMAP_FORMAT_A_8:
-		pixelFormat = PixelFormat::A_8;
-		break;
-	case ANDROID_BITMAP_FORMAT_RGB_565:
-		pixelFormat = PixelFormat::RGB_565;
-		break;
-	case ANDROID_BITMAP_FORMAT_RGBA_4444:
-		pixelFormat = PixelFormat::RGBA_4444;
-		break;
-	case ANDROID_BITMAP_FORMAT_RGBA_8888:
-		pixelFormat = PixelFormat::RGBA_8888;
-		break;
-	case ANDROID_BITMAP_FORMAT_NONE:
-		pixelFormat = PixelFormat::None;
-		break;
-	}
-
-	const byte_t* pixels = bitmapHolder.LockPixels();
-	return std::make_shared<Texture2D>(info.width, info.height, pixels, filtering, repeat, pixelFormat);
-}
-
-std::shared_ptr<ShaderProgram> AssetManager::LoadShaderProgram(const std::string& vertexShaderName, const std::string& fragmentShaderName)
-{
-	const auto iter = mShaderPrograms.find(vertexShaderName + fragmentShaderName);
-	if (iter != mShaderPrograms.end())
-	{
-		const std::shared_ptr<ShaderProgram> shader = iter->second.lock();
-		if (shader != nullptr)
-			return shader;
-		else
-			mShaderPrograms.erase(iter);
-	}
-
-	const std::string vertexShader = LoadTextFile(vertexShaderName);
-	const std::string fragmentShader = LoadTextFile(fragmentShaderName);
-	PACMAN_CHECK_ERROR((vertexShader.size() > 0) && (fragmentShader.size() > 0));
-
-	const std::shared_ptr<ShaderProgram> shader = std::make_shared<ShaderProgram>(vertexShader, fragmentShader);
-	shader->Link();
-	mShaderPrograms.insert(std::make_pair(vertexShaderName + fragmentShaderName, shader));
-	return shader;
-}
-
-std::unique_ptr<SpriteSheet> AssetManager::LoadSpriteSheet(const std::string& name)
-{
-    const std::string jsonData = LoadTextFile(name);
-    PACMAN_CHECK_ERROR(jsonData.size() > 0);
-
-    const JsonHelper::Value root(jsonData);
-
-    typedef EnumType<TextureFiltering>::value TextureFilteringValueT;
-    const std::string image = root.GetValue<std::string>("image");
-    const TextureFilteringValueT filtering = root.GetValue<TextureFilteringValueT>("filtering");
-    const JsonHelper::Array list  = root.GetValue<JsonHelper::Array>("list");
-    PACMAN_CHECK_ERROR((image.size() > 0) && (list.GetSize() > 0));
-
-    const std::shared_ptr<Texture2D> texture = LoadTexture(image, MakeEnum<TextureFiltering>(filtering), TextureRepeat::None);
-
-    NamedSpriteInfoArray namedSpritesInfo;
-    namedSpritesInfo.reserve(list.GetSize());
-
-    for (const JsonHelper::Value& sprite : list)
-    {
-        const std::string name = sprite.GetValue<std::string>("name");
-        const std::string vs   = sprite.GetValue<std::string>("vs");
-        const std::string fs   = sprite.GetValue<std::string>("fs");
-        const bool alphaBlend  = sprite.GetValue<bool>("alpha_blend");
-        PACMAN_CHECK_ERROR((name.size() > 0) && (vs.size() > 0) && (fs.size() > 0));
-
-        const float x = sprite.GetValue<float>("x");
-        const float y = sprite.GetValue<float>("y");
-        const float width = sprite.GetValue<float>("width");
-        const float height = sprite.GetValue<float>("height");
-
-        const SpriteInfo spriteInfo  
-        {
-            TextureRegion(x, y, width, height),
-                          vs,
-                          fs,
-                          alphaBlend
-        };
-
-        namedSpritesInfo.push_back(std::make_pair(name, spriteInfo));
-    }
-
-    return MakeUnique<SpriteSheet>(std::move(texture), namedSpritesInfo);
-}
-
-std::string AssetManager::LoadTextFile(const std::string& name)
-{
-	JNIEnv* env = JNI::GetEnv();
-
-	jobject byteArray = LoadFileFromAssets(name);
-	PACMAN_CHECK_ERROR(byteArray != nullptr);
-
-	const char* buf = static_cast<const char*>(env->GetDirectBufferAddress(byteArray));
-	PACMAN_CHECK_ERROR(buf != nullptr);
-
-	const jlong capacity = env->GetDirectBufferCapacity(byteArray);
-	return std::string(buf, capacity);
-}
-
-} // Pacman namespace
+#include "asset_manager.h"
+
+#include <new>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#ifdef PACMAN_HEADLESS
+#include <fstream>
+#include <sstream>
+#else
+#include <android/bitmap.h>
+#endif
+
+#include "engine.h"
+#include "error.h"
+#include "color.h"
+#include "texture.h"
+#include "shader_program.h"
+#include "spritesheet.h"
+#include "json_helper.h"
+#include "utils.h"
+#ifndef PACMAN_HEADLESS
+#include "jni_utility.h"
+#endif
+
+namespace Pacman {
+
+const std::string AssetManager::kDefaultColorVertexShader         = "def_color_shader.vs";
+const std::string AssetManager::kDefaultStaticColorVertexShader   = "def_static_color_shader.vs";
+const std::string AssetManager::kDefaultColorFragmentShader       = "def_color_shader.fs";
+const std::string AssetManager::kDefaultTextureVertexShader       = "def_texture_shader.vs";
+const std::string AssetManager::kDefaultStaticTextureVertexShader = "def_static_texture_shader.vs";
+const std::string AssetManager::kDefaultSpriteVertexShader        = "def_sprite_shader.vs";
+const std::string AssetManager::kDefaultTextureFragmentShader     = "def_texture_shader.fs";
+const std::string AssetManager::kDefaultAlphaPlaneFragmentShader  = "def_alpha_plane_texture_shader.fs";
+
+// compressed variants of the <name>.png texture, written by the texture_compressor tool
+static const std::string kETC2TextureExtension = ".etc2.ktx";
+static const std::string kETC1TextureExtension = ".etc1.ktx";
+static const std::string kETC1AlphaPlaneExtension = ".alpha.etc1.ktx";
+
+static const byte_t kKtxIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+static const uint32_t kKtxEndianness = 0x04030201;
+
+// KTX 1.1 file header
+struct KtxHeader
+{
+	byte_t   mIdentifier[12];
+	uint32_t mEndianness;
+	uint32_t mGLType;
+	uint32_t mGLTypeSize;
+	uint32_t mGLFormat;
+	uint32_t mGLInternalFormat;
+	uint32_t mGLBaseInternalFormat;
+	uint32_t mPixelWidth;
+	uint32_t mPixelHeight;
+	uint32_t mPixelDepth;
+	uint32_t mNumberOfArrayElements;
+	uint32_t mNumberOfFaces;
+	uint32_t mNumberOfMipmapLevels;
+	uint32_t mBytesOfKeyValueData;
+};
+
+#ifndef PACMAN_HEADLESS
+class AndroidBitmapHolder
+{
+public:
+
+	AndroidBitmapHolder() = delete;
+	AndroidBitmapHolder(JNIEnv* env, jobject bitmap)
+		: mEnv(env), mBitmap(bitmap), mIsLocked(false)
+	{
+	}
+
+	AndroidBitmapHolder(const AndroidBitmapHolder&) = delete;
+    AndroidBitmapHolder(AndroidBitmapHolder&&) = delete;
+	~AndroidBitmapHolder()
+	{
+		UnlockPixels();
+	}
+
+	AndroidBitmapHolder& operator= (const AndroidBitmapHolder&) = delete;
+	void* operator new (size_t) throw (std::bad_alloc) = delete;
+	void* operator new (size_t, const std::nothrow_t&) throw() = delete;
+	void* operator new[] (size_t) throw (std::bad_alloc) = delete;
+	void* operator new[] (size_t, const std::nothrow_t&) throw() = delete;
+
+	AndroidBitmapInfo GetInfo() const
+	{
+		AndroidBitmapInfo info;
+		int res = AndroidBitmap_getInfo(mEnv, mBitmap, &info);
+		PACMAN_CHECK_ERROR(res == ANDROID_BITMAP_RESUT_SUCCESS);
+		return info;
+	}
+
+	const byte_t* LockPixels()
+	{
+		void* pixels = nullptr;
+		int res = AndroidBitmap_lockPixels(mEnv, mBitmap, &pixels);
+		PACMAN_CHECK_ERROR(res == ANDROID_BITMAP_RESUT_SUCCESS);
+		mIsLocked = true;
+		return static_cast<const byte_t*>(pixels);
+	}
+
+	void UnlockPixels()
+	{
+		if (mIsLocked)
+		{
+			AndroidBitmap_unlockPixels(mEnv, mBitmap);
+			mIsLocked = false;
+		}
+	}
+
+private:
+
+	JNIEnv* mEnv;
+	jobject mBitmap;
+	bool 	mIsLocked;
+};
+#endif
+
+std::string ApplyMultiplier(const std::string& name, const size_t multiplier)
+{
+	std::ostringstream result;
+	const size_t dotPos = name.find_last_of('.');
+	PACMAN_CHECK_ERROR((dotPos != std::string::npos) && (dotPos < name.size()));
+
+    return MakeString(name.substr(0, dotPos),                      // add name
+                      "@", multiplier,                             // add multiplier
+                      "x.", name.substr(dotPos + 1, name.size())); // add extension
+}
+
+#ifndef PACMAN_HEADLESS
+jobject LoadBitmapFromAssets(const std::string& name)
+{
+	jstring assetName = JNI::MakeUTF8String(name.c_str());
+	return JNI::CallStaticObjectMethod("com/imdex/pacman/NativeLib", "loadAssetBitmap",
+									   "(Ljava/lang/String;)Landroid/graphics/Bitmap;", assetName);
+}
+
+jobject LoadFileFromAssets(const std::string& name)
+{
+	jstring assetName = JNI::MakeUTF8String(name.c_str());
+	return JNI::CallStaticObjectMethod("com/imdex/pacman/NativeLib", "loadAssetFile",
+									   "(Ljava/lang/String;)Ljava/nio/ByteBuffer;", assetName);
+}
+
+// returns an empty string if the file isn't found, the data can be binary
+std::string TryLoadFile(const std::string& name)
+{
+	JNIEnv* env = JNI::GetEnv();
+
+	jobject byteArray = LoadFileFromAssets(name);
+	if (byteArray == nullptr)
+		return std::string();
+
+	const char* buf = static_cast<const char*>(env->GetDirectBufferAddress(byteArray));
+	PACMAN_CHECK_ERROR(buf != nullptr);
+
+	const jlong capacity = env->GetDirectBufferCapacity(byteArray);
+	return std::string(buf, capacity);
+}
+#else
+
+// the directory of the headless build assets
+static std::string gAssetsDirectory = "assets";
+
+// returns an empty string if the file isn't found, the data can be binary
+std::string TryLoadFile(const std::string& name)
+{
+	std::ifstream file(gAssetsDirectory + "/" + name, std::ios::in | std::ios::binary);
+	if (!file)
+		return std::string();
+
+	std::ostringstream data;
+	data << file.rdbuf();
+	return data.str();
+}
+#endif
+
+std::string ReplaceExtension(const std::string& name, const std::string& extension)
+{
+	const size_t dotPos = name.find_last_of('.');
+	PACMAN_CHECK_ERROR(dotPos != std::string::npos);
+	return name.substr(0, dotPos) + extension;
+}
+
+// returns nullptr if the file isn't found
+// only the base level of the texture is uploaded
+std::shared_ptr<Texture2D> TryLoadKtxTexture(const std::string& name, const TextureFiltering filtering,
+											 const TextureRepeat repeat, const CompressedFormat compressedFormat)
+{
+	const std::string data = TryLoadFile(name);
+	if (data.empty())
+		return nullptr;
+
+	KtxHeader header;
+	PACMAN_CHECK_ERROR2(data.size() > sizeof(header), name.c_str());
+	std::memcpy(&header, data.data(), sizeof(header));
+
+	PACMAN_CHECK_ERROR2(std::memcmp(header.mIdentifier, kKtxIdentifier, sizeof(kKtxIdentifier)) == 0, name.c_str());
+	PACMAN_CHECK_ERROR2(header.mEndianness == kKtxEndianness, name.c_str());
+	PACMAN_CHECK_ERROR2((header.mNumberOfFaces == 1) && (header.mPixelDepth == 0), name.c_str());
+
+	const size_t levelOffset = sizeof(header) + header.mBytesOfKeyValueData;
+	PACMAN_CHECK_ERROR2(data.size() >= levelOffset + sizeof(uint32_t), name.c_str());
+
+	uint32_t imageSize = 0;
+	std::memcpy(&imageSize, data.data() + levelOffset, sizeof(imageSize));
+	PACMAN_CHECK_ERROR2(data.size() >= levelOffset + sizeof(uint32_t) + imageSize, name.c_str());
+
+	const byte_t* image = reinterpret_cast<const byte_t*>(data.data() + levelOffset + sizeof(uint32_t));
+	const std::shared_ptr<Texture2D> texture = std::make_shared<Texture2D>(header.mPixelWidth, header.mPixelHeight, image, imageSize,
+																		   filtering, repeat, compressedFormat);
+	return texture;
+}
+
+// the best compressed format supported by the device is preferred
+// returns nullptr if the device supports no compressed format or there is no compressed variant of the texture
+std::shared_ptr<Texture2D> TryLoadCompressedTexture(const std::string& name, const TextureFiltering filtering,
+													const TextureRepeat repeat)
+{
+	if (Texture2D::IsFormatSupported(CompressedFormat::ETC2_RGBA8))
+	{
+		const std::shared_ptr<Texture2D> texture = TryLoadKtxTexture(ReplaceExtension(name, kETC2TextureExtension),
+																	 filtering, repeat, CompressedFormat::ETC2_RGBA8);
+		if (texture != nullptr)
+			return texture;
+	}
+
+	if (Texture2D::IsFormatSupported(CompressedFormat::ETC1_RGB8))
+	{
+		const std::shared_ptr<Texture2D> texture = TryLoadKtxTexture(ReplaceExtension(name, kETC1TextureExtension),
+																	 filtering, repeat, CompressedFormat::ETC1_RGB8);
+		if (texture != nullptr)
+		{
+			// opaque textures have no alpha plane
+			texture->SetAlphaPlane(TryLoadKtxTexture(ReplaceExtension(name, kETC1AlphaPlaneExtension),
+													 filtering, repeat, CompressedFormat::ETC1_RGB8));
+			return texture;
+		}
+	}
+
+	return nullptr;
+}
+
+#ifndef PACMAN_HEADLESS
+// returns nullptr if the file isn't found
+std::shared_ptr<Texture2D> TryLoadBitmapTexture(const std::string& name, const TextureFiltering filtering,
+												const TextureRepeat repeat)
+{
+	JNIEnv* env = JNI::GetEnv();
+
+	jobject bitmap = LoadBitmapFromAssets(name);
+	if (bitmap == nullptr)
+		return nullptr;
+
+	AndroidBitmapHolder bitmapHolder(env, bitmap);
+	const AndroidBitmapInfo info = bitmapHolder.GetInfo();
+
+	PixelFormat pixelFormat = PixelFormat::None;
+	switch (info.format)
+	{
+	case ANDROID_BITMAP_FORMAT_A_8:
+		pixelFormat = PixelFormat::A_8;
+		break;
+	case ANDROID_BITMAP_FORMAT_RGB_565:
+		pixelFormat = PixelFormat::RGB_565;
+		break;
+	case ANDROID_BITMAP_FORMAT_RGBA_4444:
+		pixelFormat = PixelFormat::RGBA_4444;
+		break;
+	case ANDROID_BITMAP_FORMAT_RGBA_8888:
+		pixelFormat = PixelFormat::RGBA_8888;
+		break;
+	case ANDROID_BITMAP_FORMAT_NONE:
+		pixelFormat = PixelFormat::None;
+		break;
+	}
+
+	const byte_t* pixels = bitmapHolder.LockPixels();
+	return std::make_shared<Texture2D>(info.width, info.height, pixels, filtering, repeat, pixelFormat);
+}
+#else
+
+// there is no bitmap decoder without the VM, the renderer doesn't draw anything in the headless build,
+// so the texture has the size of the PNG image without the pixels
+// returns nullptr if the file isn't found
+std::shared_ptr<Texture2D> TryLoadBitmapTexture(const std::string& name, const TextureFiltering filtering,
+												const TextureRepeat repeat)
+{
+	static const size_t kPngSizeOffset = 16; // the big endian width and height of the IHDR chunk
+
+	const std::string data = TryLoadFile(name);
+	if (data.empty())
+		return nullptr;
+
+	PACMAN_CHECK_ERROR2(data.size() >= kPngSizeOffset + 2 * sizeof(uint32_t), name.c_str());
+	const byte_t* size = reinterpret_cast<const byte_t*>(data.data() + kPngSizeOffset);
+	const size_t width = (size[0] << 24) | (size[1] << 16) | (size[2] << 8) | size[3];
+	const size_t height = (size[4] << 24) | (size[5] << 16) | (size[6] << 8) | size[7];
+	return std::make_shared<Texture2D>(width, height, nullptr, filtering, repeat, PixelFormat::RGBA_8888);
+}
+#endif
+
+// the compressed variant is preferred to the bitmap
+std::shared_ptr<Texture2D> TryLoadTexture(const std::string& name, const TextureFiltering filtering,
+										  const TextureRepeat repeat)
+{
+	const std::shared_ptr<Texture2D> texture = TryLoadCompressedTexture(name, filtering, repeat);
+	return (texture != nullptr) ? texture : TryLoadBitmapTexture(name, filtering, repeat);
+}
+
+//=================================================================================================================
+
+std::shared_ptr<Texture2D> AssetManager::LoadTexture(const std::string& name, const TextureFiltering filtering,
+									 	 	 	     const TextureRepeat repeat)
+{
+	std::shared_ptr<Texture2D> texture = nullptr;
+	if (mMultiplier > 0)
+		texture = TryLoadTexture(ApplyMultiplier(name, mMultiplier), filtering, repeat); // try to load texture with multiplier
+
+	if (texture == nullptr)
+		texture = TryLoadTexture(name, filtering, repeat); // after try base
+
+	PACMAN_CHECK_ERROR2(texture != nullptr, name.c_str());
+	return texture;
+}
+
+std::shared_ptr<ShaderProgram> AssetManager::LoadShaderProgram(const std::string& vertexShaderName, const std::string& fragmentShaderName)
+{
+	const auto iter = mShaderPrograms.find(vertexShaderName + fragmentShaderName);
+	if (iter != mShaderPrograms.end())
+	{
+		const std::shared_ptr<ShaderProgram> shader = iter->second.lock();
+		if (shader != nullptr)
+			return shader;
+		else
+			mShaderPrograms.erase(iter);
+	}
+
+	const std::string vertexShader = LoadTextFile(vertexShaderName);
+	const std::string fragmentShader = LoadTextFile(fragmentShaderName);
+	PACMAN_CHECK_ERROR((vertexShader.size() > 0) && (fragmentShader.size() > 0));
+
+	const std::shared_ptr<ShaderProgram> shader = std::make_shared<ShaderProgram>(vertexShader, fragmentShader);
+	shader->Link();
+	mShaderPrograms.insert(std::make_pair(vertexShaderName + fragmentShaderName, shader));
+	return shader;
+}
+
+std::unique_ptr<SpriteSheet> AssetManager::LoadSpriteSheet(const std::string& name)
+{
+    // the atlas packer writes a manifest per multiplier
+    std::string jsonData = (mMultiplier > 0) ? TryLoadFile(ApplyMultiplier(name, mMultiplier))
+                                             : std::string();
+    if (jsonData.empty())
+        jsonData = LoadTextFile(name);
+    PACMAN_CHECK_ERROR(jsonData.size() > 0);
+
+    const JsonHelper::Value root(jsonData);
+
+    typedef EnumType<TextureFiltering>::value TextureFilteringValueT;
+    const TextureFilteringValueT filtering = root.GetValue<TextureFilteringValueT>("filtering");
+    const JsonHelper::Array list  = root.GetValue<JsonHelper::Array>("list");
+    PACMAN_CHECK_ERROR(list.GetSize() > 0);
+
+    // single texture sheets have the "image" instead of the "pages"
+    std::vector<std::string> pageNames;
+    if (root.HasValue("pages"))
+    {
+        for (const JsonHelper::Value& page : root.GetValue<JsonHelper::Array>("pages"))
+        {
+            pageNames.push_back(page.GetAs<std::string>());
+        }
+    }
+    else
+    {
+        pageNames.push_back(root.GetValue<std::string>("image"));
+    }
+
+    TexturePagesArray pages;
+    pages.reserve(pageNames.size());
+    for (const std::string& pageName : pageNames)
+    {
+        PACMAN_CHECK_ERROR(pageName.size() > 0);
+        pages.push_back(LoadTexture(pageName, MakeEnum<TextureFiltering>(filtering), TextureRepeat::None));
+    }
+
+    NamedSpriteInfoArray namedSpritesInfo;
+    namedSpritesInfo.reserve(list.GetSize());
+
+    for (const JsonHelper::Value& sprite : list)
+    {
+        const std::string name = sprite.GetValue<std::string>("name");
+        const std::string vs   = sprite.GetValue<std::string>("vs");
+        std::string fs         = sprite.GetValue<std::string>("fs");
+        const bool alphaBlend  = sprite.GetValue<bool>("alpha_blend");
+        const size_t page      = sprite.HasValue("page") ? sprite.GetValue<uint32_t>("page") : 0;
+        PACMAN_CHECK_ERROR((name.size() > 0) && (vs.size() > 0) && (fs.size() > 0) && (page < pages.size()));
+
+        // the ETC1 page keeps its alpha in the alpha plane texture
+        if (pages[page]->HasAlphaPlane() && (fs == kDefaultTextureFragmentShader))
+            fs = kDefaultAlphaPlaneFragmentShader;
+
+        const float x = sprite.GetValue<float>("x");
+        const float y = sprite.GetValue<float>("y");
+        const float width = sprite.GetValue<float>("width");
+        const float height = sprite.GetValue<float>("height");
+
+        const SpriteInfo spriteInfo  
+        {
+            page,
+            TextureRegion(x, y, width, height),
+                          vs,
+                          fs,
+                          alphaBlend
+        };
+
+        namedSpritesInfo.push_back(std::make_pair(name, spriteInfo));
+
+        // the last loaded sheet wins on the name clash
+        const AtlasSprite atlasSprite = { pages[page], spriteInfo };
+        mAtlasSprites.erase(name);
+        mAtlasSprites.insert(std::make_pair(name, atlasSprite));
+    }
+
+    return MakeUnique<SpriteSheet>(pages, namedSpritesInfo);
+}
+
+bool AssetManager::FindAtlasSprite(const std::string& name, std::shared_ptr<Texture2D>& page, SpriteInfo& info) const
+{
+    const auto iter = mAtlasSprites.find(name);
+    if (iter == mAtlasSprites.end())
+        return false;
+
+    page = iter->second.mPage.lock();
+    info = iter->second.mInfo;
+    return page != nullptr;
+}
+
+std::string AssetManager::LoadTextFile(const std::string& name)
+{
+	const std::string data = TryLoadFile(name);
+	PACMAN_CHECK_ERROR2(data.size() > 0, name.c_str());
+	return data;
+}
+
+#ifdef PACMAN_HEADLESS
+void AssetManager::SetAssetsDirectory(const std::string& directory)
+{
+	gAssetsDirectory = directory;
+}
+#endif
+
+} // Pacman namespace
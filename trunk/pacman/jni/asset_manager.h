@@ -1,61 +1,85 @@
-#pragma once
-
-#include <memory>
-#include <string>
-#include <unordered_map>
-
-#include "base.h"
-#include "engine_forwdecl.h"
-
-namespace Pacman {
-
-// TODO: add context lost support
-class AssetManager
-{
-public:
-
-	// attrs: position, color; uniforms: modelView
-	static const std::string kDefaultColorVertexShader;
-	// attrs: position, color; uniforms: none
-	static const std::string kDefaultStaticColorVertexShader;
-	// varying: color
-	static const std::string kDefaultColorFragmentShader;
-	// attrs: position, texcoords; uniforms: modelView
-	static const std::string kDefaultTextureVertexShader;
-	// attrs: position, texcoords; uniforms: none
-	static const std::string kDefaultStaticTextureVertexShader;
-	// varying: texcoords
-	static const std::string kDefaultTextureFragmentShader;
-
-	AssetManager() = default;
-	AssetManager(const AssetManager&) = delete;
-	~AssetManager() = default;
-
-	AssetManager& operator= (const AssetManager&) = delete;
-
-	std::shared_ptr<Texture2D> LoadTexture(const std::string& name, const TextureFiltering filtering,
-										   const TextureRepeat repeat);
-
-	std::shared_ptr<ShaderProgram> LoadShaderProgram(const std::string& vertexShaderName, const std::string& fragmentShaderName);
-
-    std::unique_ptr<SpriteSheet> LoadSpriteSheet(const std::string& name);
-
-	std::string LoadTextFile(const std::string& name);
-
-	void SetMultiplier(const size_t multiplier)
-	{
-		mMultiplier = multiplier;
-	}
-
-	size_t GetMultiplier() const
-	{
-		return mMultiplier;
-	}
-
-private:
-	
-	size_t mMultiplier;
-	std::unordered_map<std::string, std::weak_ptr<ShaderProgram>> mShaderPrograms;
-};
-
-} // Pacman namespace
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "base.h"
+#include "engine_forwdecl.h"
+#include "spritesheet.h"
+
+namespace Pacman {
+
+// atlas page and region of the sprite
+struct AtlasSprite
+{
+    std::weak_ptr<Texture2D> mPage;
+    SpriteInfo               mInfo;
+};
+
+// TODO: add context lost support
+class AssetManager
+{
+public:
+
+	// attrs: position, color; uniforms: modelView
+	static const std::string kDefaultColorVertexShader;
+	// attrs: position, color; uniforms: none
+	static const std::string kDefaultStaticColorVertexShader;
+	// varying: color
+	static const std::string kDefaultColorFragmentShader;
+	// attrs: position, texcoords; uniforms: modelView
+	static const std::string kDefaultTextureVertexShader;
+	// attrs: position, texcoords; uniforms: none
+	static const std::string kDefaultStaticTextureVertexShader;
+	// attrs: position, texcoords (of the unit quad); uniforms: modelView, spriteRect, textureRegion
+	static const std::string kDefaultSpriteVertexShader;
+	// varying: texcoords
+	static const std::string kDefaultTextureFragmentShader;
+	// varying: texcoords; the alpha is sampled from the alpha plane (see Texture2D::SetAlphaPlane)
+	static const std::string kDefaultAlphaPlaneFragmentShader;
+
+	AssetManager() = default;
+	AssetManager(const AssetManager&) = delete;
+	~AssetManager() = default;
+
+	AssetManager& operator= (const AssetManager&) = delete;
+
+	// the compressed variant (<name>.etc2.ktx or <name>.etc1.ktx) supported by the device is preferred to the bitmap
+	std::shared_ptr<Texture2D> LoadTexture(const std::string& name, const TextureFiltering filtering,
+										   const TextureRepeat repeat);
+
+	std::shared_ptr<ShaderProgram> LoadShaderProgram(const std::string& vertexShaderName, const std::string& fragmentShaderName);
+
+    // the manifest with the multiplier (name@Nx.json) is preferred, sprites are registered in the atlas registry
+    std::unique_ptr<SpriteSheet> LoadSpriteSheet(const std::string& name);
+
+    // find the sprite in the loaded sprite sheets
+    // returns false if the sprite isn't found or its sprite sheet was released
+    bool FindAtlasSprite(const std::string& name, std::shared_ptr<Texture2D>& page, SpriteInfo& info) const;
+
+	std::string LoadTextFile(const std::string& name);
+
+#ifdef PACMAN_HEADLESS
+	// the headless build reads the assets from the directory instead of the package
+	static void SetAssetsDirectory(const std::string& directory);
+#endif
+
+	void SetMultiplier(const size_t multiplier)
+	{
+		mMultiplier = multiplier;
+	}
+
+	size_t GetMultiplier() const
+	{
+		return mMultiplier;
+	}
+
+private:
+	
+	size_t mMultiplier;
+	std::unordered_map<std::string, std::weak_ptr<ShaderProgram>> mShaderPrograms;
+	std::unordered_map<std::string, AtlasSprite> mAtlasSprites;
+};
+
+} // Pacman namespace
@@ -1,23 +1,46 @@
-#pragma once
-
-#include <memory>
-
-#include "base.h"
-#include "engine_forwdecl.h"
-
-namespace Pacman {
-
-class IDrawable
-{
-public:
-
-	virtual std::shared_ptr<VertexBuffer> GetVertexBuffer() const = 0;
-
-	virtual std::weak_ptr<Texture2D> GetTexture() const = 0;
-
-	virtual std::shared_ptr<ShaderProgram> GetShaderProgram() const = 0;
-
-	virtual bool HasAlphaBlend() const = 0;
-};
-
-} // Pacman namespace
+#pragma once
+
+#include <memory>
+
+#include "base.h"
+#include "engine_forwdecl.h"
+#include "engine_typedefs.h"
+
+namespace Pacman {
+
+// textured quad of a drawable which can be merged with others by the SpriteBatch
+struct SpriteQuad
+{
+	SpriteRegion  mRegion;
+	TextureRegion mTextureRegion;
+};
+
+// uniforms of the sprite vertex shader (AssetManager::kDefaultSpriteVertexShader),
+// the unit quad is placed by the SpriteQuad values, the identity ones keep the vertices as is
+static const char* const kSpriteRectUniformName = "mSpriteRect";
+static const char* const kTextureRegionUniformName = "mTextureRegion";
+
+class IDrawable
+{
+public:
+
+	virtual std::shared_ptr<VertexBuffer> GetVertexBuffer() const = 0;
+
+	virtual std::weak_ptr<Texture2D> GetTexture() const = 0;
+
+	virtual std::shared_ptr<ShaderProgram> GetShaderProgram() const = 0;
+
+	virtual bool HasAlphaBlend() const = 0;
+
+	// nullptr if the drawable can't be batched
+	virtual const SpriteQuad* GetSpriteQuad() const = 0;
+
+	// the drawable of the current state, it's drawn instead of the animated one
+	// (the render snapshot keeps it, so the simulation thread can change the state meanwhile)
+	virtual const IDrawable* GetCurrentFrame() const
+	{
+		return this;
+	}
+};
+
+} // Pacman namespace
@@ -1,129 +1,269 @@
-#include "engine.h"
-
-#include <unistd.h>
-
-#include "main.h"
-#include "error.h"
-#include "asset_manager.h"
-#include "scene_manager.h"
-#include "renderer.h"
-#include "input_manager.h"
-#include "timer.h"
-#include "jni_utility.h"
-#include "json_helper.h"
-
-namespace Pacman {
-
-static const size_t kFramesPerSecond = 25;
-static const size_t kSkipTicks = 1000 / kFramesPerSecond;
-
-static FORCEINLINE void showLoadingDialog()
-{
-    JNI::CallStaticVoidMethod("com/imdex/pacman/NativeLib", "showLoadingDialog", "()V");
-}
-
-static FORCEINLINE void hideLoadingDialog()
-{
-    JNI::CallStaticVoidMethod("com/imdex/pacman/NativeLib", "hideLoadingDialog", "()V");
-}
-
-Engine::Engine()
-	  : mAssetManager(new AssetManager()),
-		mSceneManager(new SceneManager()),
-		mRenderer(new Renderer()),
-        mInputManager(new InputManager()),
-		mTimer(new Timer()),
-		mListener(nullptr),
-		mLastTime(0),
-        mBaseWidth(0),
-        mBaseHeight(0),
-        mStarted(false)
-{
-}
-
-Engine::~Engine()
-{
-}
-
-void Engine::Start(const size_t screenWidth, const size_t screenHeight)
-{
-    if (!mStarted)
-    {
-        std::string configData = mAssetManager->LoadTextFile("config.json");
-        const JsonHelper::Value root(configData);
-
-        const JsonHelper::Value resolution = root.GetValue<JsonHelper::Value>("base_resolution");
-        mBaseWidth = resolution.GetValue<size_t>("width");
-        mBaseHeight = resolution.GetValue<size_t>("height");
-    }
-    else
-    {
-        mListener->OnStop(*this);
-        mListener = nullptr;
-        mAssetManager = nullptr;
-        mSceneManager = nullptr;
-        mRenderer = nullptr;
-        mInputManager = nullptr;
-        mTimer = nullptr;
-        mLastTime = 0;
-        ErrorHandler::CleanGLErrors();
-    }
-    
-    mAssetManager = MakeUnique<AssetManager>();
-    mSceneManager = MakeUnique<SceneManager>();
-    mRenderer = MakeUnique<Renderer>();
-    mInputManager = MakeUnique<InputManager>();
-    mTimer = MakeUnique<Timer>();
-    PacmanSetEngineListener(*this);
-    PACMAN_CHECK_ERROR(mListener != nullptr);
-
-	const size_t resolutionMultiplier = std::min(screenWidth / mBaseWidth, screenHeight / mBaseHeight);
-	mAssetManager->SetMultiplier(resolutionMultiplier);
-	mRenderer->Init(screenWidth, screenHeight);
-    mStarted = true;
-
-    showLoadingDialog();
-    mListener->OnStart(*this);
-    hideLoadingDialog();
-
-	mTimer->Start();
-	mLastTime = mTimer->GetMillisec();
-}
-
-void Engine::OnDrawFrame()
-{
-    mInputManager->Update();
-	if (mListener != nullptr)
-		mListener->OnUpdate(*this, kSkipTicks);
-	mRenderer->DrawFrame();
-
-	mLastTime += kSkipTicks;
-    const uint64_t now = mTimer->GetMillisec();
-	if (mLastTime >= now)
-    {
-        const uint64_t sleepTime = mLastTime - now;
-		usleep(sleepTime * 1000);
-    }
-}
-
-void Engine::OnTouch(const int event, const float x, const float y)
-{
-    typedef EnumType<TouchEvent>::value TouchEventValueT;
-    const TouchEventValueT eventValue = static_cast<TouchEventValueT>(event);
-    const TouchInfo info = { MakeEnum<TouchEvent>(eventValue), x, y };
-	mInputManager->PushInfo(info);
-}
-
-void Engine::ShowMessage(const std::string& message) const
-{
-    JNI::CallStaticVoidMethod("com/imdex/pacman/NativeLib", "showGameMessage", "(Ljava/lang/String;)V",
-                              JNI::MakeUTF8String(message.c_str()));
-}
-
-void Engine::ShowInfo(const std::string& message, const std::string& title, const bool terminate)
-{
-    JNI::CallStaticVoidMethod("com/imdex/pacman/NativeLib", "showInfoDialog", "(Ljava/lang/String;Ljava/lang/String;Z)V",
-                              JNI::MakeUTF8String(message.c_str()), JNI::MakeUTF8String(title.c_str()), terminate);
-}
-
+#include "engine.h"
+
+#include <algorithm>
+
+#include "main.h"
+#include "log.h"
+#include "error.h"
+#include "asset_manager.h"
+#include "scene_manager.h"
+#include "renderer.h"
+#include "render_snapshot.h"
+#include "simulation_thread.h"
+#include "input_manager.h"
+#include "profiler.h"
+#include "allocation_tracker.h"
+#include "timer.h"
+#ifndef PACMAN_HEADLESS
+#include "jni_utility.h"
+#endif
+#include "json_helper.h"
+
+namespace Pacman {
+
+static const uint64_t kNanosecPerMillisec = 1000000;
+
+#ifdef PACMAN_PROFILER
+// the trace of the first frames is saved once, "adb shell run-as com.imdex.pacman cat pacman_trace.json" pulls it
+static const char* const kProfilerTraceFileName = "/data/data/com.imdex.pacman/pacman_trace.json";
+static const size_t kProfilerTraceFrames = 1500;
+#endif
+
+#ifdef PACMAN_ALLOCATION_TRACKING
+static const size_t kAllocationsLogFrames = 120;
+#endif
+
+#ifdef PACMAN_HEADLESS
+// there is no UI in the headless build
+static FORCEINLINE void showLoadingDialog()
+{
+}
+
+static FORCEINLINE void hideLoadingDialog()
+{
+}
+#else
+static FORCEINLINE void showLoadingDialog()
+{
+    JNI::CallStaticVoidMethod("com/imdex/pacman/NativeLib", "showLoadingDialog", "()V");
+}
+
+static FORCEINLINE void hideLoadingDialog()
+{
+    JNI::CallStaticVoidMethod("com/imdex/pacman/NativeLib", "hideLoadingDialog", "()V");
+}
+#endif
+
+Engine::Engine()
+	  : mAssetManager(new AssetManager()),
+		mSceneManager(new SceneManager()),
+		mRenderer(new Renderer()),
+        mInputManager(new InputManager()),
+		mTimer(new Timer()),
+        mSimulationThread(nullptr),
+        mSnapshot(new RenderSnapshot()),
+		mListener(nullptr),
+		mLastTime(0),
+        mAccumulatedTime(0),
+        mBaseWidth(0),
+        mBaseHeight(0),
+        mSimulationStep(0),
+        mMaxStepsPerFrame(0),
+        mWorkerThread(false),
+        mFramesCount(0),
+        mStarted(false)
+#ifdef PACMAN_HEADLESS
+        , mTerminated(false)
+#endif
+{
+}
+
+Engine::~Engine()
+{
+    // the simulation uses the listener and the managers
+    mSimulationThread = nullptr;
+}
+
+void Engine::Start(const size_t screenWidth, const size_t screenHeight)
+{
+    if (!mStarted)
+    {
+        std::string configData = mAssetManager->LoadTextFile("config.json");
+        const JsonHelper::Value root(configData);
+
+        const JsonHelper::Value resolution = root.GetValue<JsonHelper::Value>("base_resolution");
+        mBaseWidth = resolution.GetValue<size_t>("width");
+        mBaseHeight = resolution.GetValue<size_t>("height");
+
+        // the step is a whole number of milliseconds, so the rate should be a divisor of 1000
+        const JsonHelper::Value simulation = root.GetValue<JsonHelper::Value>("simulation");
+        const size_t simulationRate = simulation.GetValue<size_t>("rate");
+        PACMAN_CHECK_ERROR2((simulationRate > 0) && (1000 % simulationRate == 0), "Wrong simulation rate, it should be a divisor of 1000");
+        mSimulationStep = 1000 / simulationRate;
+        mMaxStepsPerFrame = simulation.GetValue<size_t>("max_steps_per_frame");
+        PACMAN_CHECK_ERROR2(mMaxStepsPerFrame > 0, "Wrong simulation steps limit");
+        mWorkerThread = simulation.GetValue<bool>("worker_thread");
+#ifdef PACMAN_HEADLESS
+        // the headless runner calls SimulateStep itself
+        mWorkerThread = false;
+#endif
+    }
+    else
+    {
+        // the simulation has to be stopped before the scene is destroyed
+        mSimulationThread = nullptr;
+        // the snapshot holds the drawables of the old scene, their GL objects are deleted before the new ones are created
+        mSnapshot->mNodes.clear();
+        mListener->OnStop(*this);
+        mListener = nullptr;
+        mAssetManager = nullptr;
+        mSceneManager = nullptr;
+        mRenderer = nullptr;
+        mInputManager = nullptr;
+        mTimer = nullptr;
+        mLastTime = 0;
+        mAccumulatedTime = 0;
+        ErrorHandler::CleanGLErrors();
+    }
+    
+    mAssetManager = MakeUnique<AssetManager>();
+    mSceneManager = MakeUnique<SceneManager>();
+    mRenderer = MakeUnique<Renderer>();
+    mInputManager = MakeUnique<InputManager>();
+    mTimer = MakeUnique<Timer>();
+    PacmanSetEngineListener(*this);
+    PACMAN_CHECK_ERROR(mListener != nullptr);
+
+	const size_t resolutionMultiplier = std::min(screenWidth / mBaseWidth, screenHeight / mBaseHeight);
+	mAssetManager->SetMultiplier(resolutionMultiplier);
+	mRenderer->Init(screenWidth, screenHeight);
+    mStarted = true;
+#ifdef PACMAN_HEADLESS
+    mTerminated = false;
+#endif
+
+    showLoadingDialog();
+    mListener->OnStart(*this);
+    hideLoadingDialog();
+
+	mTimer->Start();
+	mLastTime = mTimer->GetNanosec();
+    mFramesCount = 0;
+    PACMAN_PROFILE_THREAD_NAME("Render");
+
+    if (mWorkerThread)
+    {
+        mSimulationThread = MakeUnique<SimulationThread>(*this, *mTimer, mSimulationStep, mMaxStepsPerFrame);
+        mSimulationThread->Start(mLastTime);
+    }
+}
+
+void Engine::OnDrawFrame()
+{
+    mFramesCount++;
+#ifdef PACMAN_PROFILER
+    if (mFramesCount == kProfilerTraceFrames)
+        Profiler::SaveChromeTrace(kProfilerTraceFileName);
+#endif
+#ifdef PACMAN_LOG_RENDER_STATS
+    if ((mFramesCount % RenderStats::kFramesCount) == 0)
+        mRenderer->GetRenderStats().Log();
+#endif
+#ifdef PACMAN_ALLOCATION_TRACKING
+    // the steady state frames shouldn't allocate, the allocating ones are logged
+    const AllocationCounters allocations = AllocationTracker::EndFrame();
+    if (allocations.mCount > 0)
+    {
+        LogI("Frame %u allocations: %llu (%llu bytes)", static_cast<unsigned>(mFramesCount - 1),
+             static_cast<unsigned long long>(allocations.mCount), static_cast<unsigned long long>(allocations.mBytes));
+    }
+    if ((mFramesCount % kAllocationsLogFrames) == 0)
+        AllocationTracker::Log();
+#endif
+
+    const uint64_t now = mTimer->GetNanosec();
+    const uint64_t step = mSimulationStep * kNanosecPerMillisec;
+
+    // the frame is paced by the buffers swap (vsync)
+    if (mSimulationThread != nullptr)
+    {
+        const RenderSnapshot& snapshot = mSimulationThread->AcquireSnapshot(now);
+        const uint64_t sinceStep = (now > snapshot.mStepTime) ? (now - snapshot.mStepTime) : 0;
+        mRenderer->DrawFrame(snapshot, std::min(static_cast<float>(sinceStep) / static_cast<float>(step), 1.0f));
+        return;
+    }
+
+    mAccumulatedTime += now - mLastTime;
+    mLastTime = now;
+
+    // the simulation runs with the fixed step, a slow frame is caught up by several steps
+    size_t stepsCount = 0;
+    while ((mAccumulatedTime >= step) && (stepsCount < mMaxStepsPerFrame))
+    {
+        SimulateStep();
+        mAccumulatedTime -= step;
+        stepsCount++;
+    }
+
+    // the time which can't be caught up is dropped, otherwise the steps would take more and more time
+    mAccumulatedTime %= step;
+
+    mSceneManager->FillRenderNodes(mSnapshot->mNodes);
+    mRenderer->DrawFrame(*mSnapshot, static_cast<float>(mAccumulatedTime) / static_cast<float>(step));
+}
+
+void Engine::SimulateStep()
+{
+    PACMAN_PROFILE_SCOPE("Simulation.Step");
+    mInputManager->Update();
+    mSceneManager->SaveNodesPositions();
+    if (mListener != nullptr)
+        mListener->OnUpdate(*this, mSimulationStep);
+}
+
+void Engine::PostRenderCommand(const std::function<void()>& command) const
+{
+    mSimulationThread->PostRenderCommand(command);
+}
+
+void Engine::OnTouch(const int event, const float x, const float y)
+{
+    typedef EnumType<TouchEvent>::value TouchEventValueT;
+    const TouchEventValueT eventValue = static_cast<TouchEventValueT>(event);
+    const TouchInfo info = { MakeEnum<TouchEvent>(eventValue), x, y };
+	mInputManager->PushInfo(info);
+}
+
+#ifdef PACMAN_HEADLESS
+void Engine::ShowMessage(const std::string& message) const
+{
+    LogI("Message: %s", message.c_str());
+}
+
+void Engine::ShowInfo(const std::string& message, const std::string& title, const bool terminate)
+{
+    LogI("%s: %s", title.c_str(), message.c_str());
+    mTerminated = mTerminated || terminate;
+}
+#else
+// the JNI calls are made by the render thread, the simulation thread isn't attached to the VM
+void Engine::ShowMessage(const std::string& message) const
+{
+    RunOnRenderThread([message]()
+    {
+        JNI::CallStaticVoidMethod("com/imdex/pacman/NativeLib", "showGameMessage", "(Ljava/lang/String;)V",
+                                  JNI::MakeUTF8String(message.c_str()));
+    });
+}
+
+void Engine::ShowInfo(const std::string& message, const std::string& title, const bool terminate)
+{
+    RunOnRenderThread([message, title, terminate]()
+    {
+        JNI::CallStaticVoidMethod("com/imdex/pacman/NativeLib", "showInfoDialog", "(Ljava/lang/String;Ljava/lang/String;Z)V",
+                                  JNI::MakeUTF8String(message.c_str()), JNI::MakeUTF8String(title.c_str()), terminate);
+    });
+}
+#endif
+
 } // Pacman namespace
\ No newline at end of file
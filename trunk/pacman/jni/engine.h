@@ -1,79 +1,115 @@
-#pragma once
-
-#include <memory>
-
-#include "base.h"
-#include "engine_forwdecl.h"
-#include "engine_listeners.h"
-
-namespace Pacman {
-
-class Engine
-{
-public:
-
-	Engine();
-	Engine(const Engine&) = delete;
-	~Engine();
-
-	Engine& operator= (const Engine&) = delete;
-
-	void Start(const size_t screenWidth, const size_t screenHeight);
-
-	void OnDrawFrame();
-
-	void OnTouch(const int event, const float x, const float y);
-
-    void ShowMessage(const std::string& message) const;
-
-    void ShowInfo(const std::string& message, const std::string& title, const bool terminate);
-
-	void SetListener(const std::shared_ptr<IEngineListener> listener)
-    {
-        mListener = std::move(listener);
-    }
-
-	AssetManager& GetAssetManager() const
-	{
-		return *mAssetManager;
-	}
-
-	SceneManager& GetSceneManager() const
-	{
-		return *mSceneManager;
-	}
-
-	Renderer& GetRenderer() const
-	{
-		return *mRenderer;
-	}
-
-    InputManager& GetInputManager() const
-    {
-        return *mInputManager;
-    }
-
-    bool IsStarted() const
-    {
-        return mStarted;
-    }
-
-private:
-
-	std::unique_ptr<AssetManager> mAssetManager;
-	std::unique_ptr<SceneManager> mSceneManager;
-	std::unique_ptr<Renderer>	  mRenderer;
-    std::unique_ptr<InputManager> mInputManager;
-	std::unique_ptr<Timer>		  mTimer;
-	
-	std::shared_ptr<IEngineListener> mListener;
-	uint64_t						 mLastTime;
-
-	size_t mBaseWidth;
-	size_t mBaseHeight;
-    bool   mStarted;
-};
-
-Engine& GetEngine();
-
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "base.h"
+#include "engine_forwdecl.h"
+#include "engine_listeners.h"
+
+namespace Pacman {
+
+class Engine
+{
+public:
+
+	Engine();
+	Engine(const Engine&) = delete;
+	~Engine();
+
+	Engine& operator= (const Engine&) = delete;
+
+	void Start(const size_t screenWidth, const size_t screenHeight);
+
+	void OnDrawFrame();
+
+	void OnTouch(const int event, const float x, const float y);
+
+    // one simulation step, it's called by the simulation thread if it's used
+    void SimulateStep();
+
+    // the GL resources are changed by the render thread only, the command is run immediately without the simulation thread,
+    // otherwise it's run before the snapshot of the current step is drawn
+    // (the immediate command isn't wrapped into std::function, it doesn't allocate)
+    template <typename Command>
+    void RunOnRenderThread(const Command& command) const
+    {
+        if (mSimulationThread != nullptr)
+            PostRenderCommand(command);
+        else
+            command();
+    }
+
+    void ShowMessage(const std::string& message) const;
+
+    void ShowInfo(const std::string& message, const std::string& title, const bool terminate);
+
+	void SetListener(const std::shared_ptr<IEngineListener> listener)
+    {
+        mListener = std::move(listener);
+    }
+
+	AssetManager& GetAssetManager() const
+	{
+		return *mAssetManager;
+	}
+
+	SceneManager& GetSceneManager() const
+	{
+		return *mSceneManager;
+	}
+
+	Renderer& GetRenderer() const
+	{
+		return *mRenderer;
+	}
+
+    InputManager& GetInputManager() const
+    {
+        return *mInputManager;
+    }
+
+    bool IsStarted() const
+    {
+        return mStarted;
+    }
+
+#ifdef PACMAN_HEADLESS
+    // ShowInfo has been called with the terminate flag, the application would be closed on the device
+    bool IsTerminated() const
+    {
+        return mTerminated;
+    }
+#endif
+
+private:
+
+    void PostRenderCommand(const std::function<void()>& command) const;
+
+	std::unique_ptr<AssetManager> mAssetManager;
+	std::unique_ptr<SceneManager> mSceneManager;
+	std::unique_ptr<Renderer>	  mRenderer;
+    std::unique_ptr<InputManager> mInputManager;
+	std::unique_ptr<Timer>		  mTimer;
+	std::unique_ptr<SimulationThread> mSimulationThread; // nullptr if the simulation is run by the render thread
+	std::unique_ptr<RenderSnapshot>   mSnapshot; // of the render thread simulation
+	
+	std::shared_ptr<IEngineListener> mListener;
+	uint64_t						 mLastTime; // in nanoseconds
+	uint64_t						 mAccumulatedTime; // not simulated yet, in nanoseconds
+
+	size_t mBaseWidth;
+	size_t mBaseHeight;
+    size_t mSimulationStep; // in milliseconds
+    size_t mMaxStepsPerFrame;
+    bool   mWorkerThread; // run the simulation by the SimulationThread
+    size_t mFramesCount; // since the start
+    bool   mStarted;
+#ifdef PACMAN_HEADLESS
+    bool   mTerminated;
+#endif
+};
+
+Engine& GetEngine();
+
 } // Pacman namespace
\ No newline at end of file
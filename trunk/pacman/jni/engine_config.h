@@ -1,10 +1,19 @@
-#pragma once
-
-#define PACMAN_WORLD_SMALL 0
-#define PACMAN_WORLD_LARGE 1
-
-#define PACMAN_WORLD_SIZE PACMAN_WORLD_SMALL
-
-//#define PACMAN_ADRENO_PROFILER_COMPATIBILITY
-
-//#define PACMAN_DEBUG_MAP_TEXTURE
\ No newline at end of file
+#pragma once
+
+#define PACMAN_WORLD_SMALL 0
+#define PACMAN_WORLD_LARGE 1
+
+#define PACMAN_WORLD_SIZE PACMAN_WORLD_SMALL
+
+//#define PACMAN_ADRENO_PROFILER_COMPATIBILITY
+
+//#define PACMAN_DEBUG_MAP_TEXTURE
+
+// record the PACMAN_PROFILE_SCOPE markers
+//#define PACMAN_PROFILER
+
+// log the RenderStats every RenderStats::kFramesCount frames
+//#define PACMAN_LOG_RENDER_STATS
+
+// count the heap allocations by the global operator new, the allocating frames are logged
+//#define PACMAN_ALLOCATION_TRACKING
\ No newline at end of file
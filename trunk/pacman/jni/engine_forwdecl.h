@@ -1,26 +1,35 @@
-#pragma once
-
-namespace Pacman {
-
-class Engine;
-class SceneNode;
-class IDrawable;
-class SceneManager;
-class InstancedSprite;
-class SpriteSheet;
-class Sprite;
-class Texture2D;
-class Color;
-class FrameAnimator;
-class ShaderProgram;
-class VertexBuffer;
-class AssetManager;
-class Renderer;
-class InputManager;
-class Timer;
-struct Vertex;
-
-enum class TextureFiltering : uint8_t;
-enum class TextureRepeat;
-
+#pragma once
+
+#include <cstdint>
+
+namespace Pacman {
+
+class Engine;
+class SceneNode;
+class IDrawable;
+class SceneManager;
+class InstancedSprite;
+class SpriteSheet;
+class Sprite;
+class Texture2D;
+class Color;
+class FrameAnimator;
+class ShaderProgram;
+class VertexBuffer;
+class AssetManager;
+class Renderer;
+class RenderQueue;
+class SpriteBatch;
+class StaticLayerCache;
+class SimulationThread;
+class InputManager;
+class Timer;
+struct Vertex;
+struct SpriteQuad;
+struct RenderNode;
+struct RenderSnapshot;
+
+enum class TextureFiltering : uint8_t;
+enum class TextureRepeat;
+
 } // Pacman namespace
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+
+#include "base.h"
+#include "error.h"
+
+namespace Pacman {
+
+// vector with the inline storage of the fixed capacity, it never allocates
+template <typename T, size_t Capacity>
+class FixedVector
+{
+public:
+
+    typedef T        value_type;
+    typedef T*       iterator;
+    typedef const T* const_iterator;
+
+    FixedVector()
+        : mSize(0)
+    {
+    }
+
+    FixedVector(const FixedVector&) = default;
+    ~FixedVector() = default;
+
+    FixedVector& operator= (const FixedVector&) = default;
+
+    void push_back(const T& value)
+    {
+        PACMAN_CHECK_ERROR(mSize < Capacity);
+        mItems[mSize++] = value;
+    }
+
+    void clear()
+    {
+        mSize = 0;
+    }
+
+    size_t size() const
+    {
+        return mSize;
+    }
+
+    bool empty() const
+    {
+        return mSize == 0;
+    }
+
+    static size_t capacity()
+    {
+        return Capacity;
+    }
+
+    T& operator[] (const size_t index)
+    {
+        return mItems[index];
+    }
+
+    const T& operator[] (const size_t index) const
+    {
+        return mItems[index];
+    }
+
+    iterator begin()
+    {
+        return mItems.data();
+    }
+
+    iterator end()
+    {
+        return mItems.data() + mSize;
+    }
+
+    const_iterator begin() const
+    {
+        return mItems.data();
+    }
+
+    const_iterator end() const
+    {
+        return mItems.data() + mSize;
+    }
+
+private:
+
+    std::array<T, Capacity> mItems;
+    size_t                  mSize;
+};
+
+} // Pacman namespace
@@ -1,122 +1,147 @@
-#pragma once
-
-#include <cstdint>
-#include <memory>
-#include <array>
-#include <cassert>
-
-#include "base.h"
-#include "game_typedefs.h"
-#include "actor_controller.h"
-#include "utils.h"
-
-namespace Pacman {
-
-class IDrawable;
-class Actor;
-class Ghost;
-class GameLoader;
-class Scheduler;
-class SpriteSheet;
-class Map;
-class DotsGrid;
-class PacmanController;
-
-static const size_t kGhostsCount = 4;
-
-struct DirectionDiscard
-{
-    CellIndex mCell;
-    MoveDirection mDirection;
-};
-
-struct AIInfo
-{
-    std::array<CellIndex, kGhostsCount> mScatterTargets;
-    uint64_t                            mScatterDuration;
-    uint64_t                            mScatterInterval;
-    std::vector<DirectionDiscard>       mDiscardCells;
-    uint64_t                            mFrightDuration;
-    Position                            mRespawn;
-};
-
-class AIController : public IActorController
-{
-public:
-
-    AIController(const Size actorSize, const SpriteSheet& spriteSheet);
-    AIController(const AIController&) = delete;
-    ~AIController() = default;
-
-    AIController& operator= (const AIController&) = delete;
-
-    void Update(const uint64_t dt);
-
-    Ghost& GetGhost(const GhostId ghostId) const;
-
-    Actor& GetGhostActor(const GhostId ghostId) const;
-
-    CellIndex GetScatterTarget(const GhostId ghostid) const;
-
-    void EnableFrightenedState();
-
-    void DisableFrightenedState();
-
-    void ResetState();
-
-    void OnGhostDead(const GhostId ghostId);
-
-    virtual void OnDirectionChanged(const MoveDirection newDirection);
-
-    virtual void OnTargetAchieved();
-
-private:
-
-    enum class SelectDirectionMethod
-    {
-        Best,
-        Random
-    };
-
-    enum class SelectTargetMethod
-    {
-        OwnBehavior,
-        Scatter
-    };
-
-    typedef std::array<std::unique_ptr<Ghost>, kGhostsCount> GhostsArray; 
-
-    GhostId GetCurrentGhostId() const;
-
-    Ghost& GetCurrentGhost() const;
-
-    void FindWayOnWaitState();
-
-    void FindWayOnLeaveHouse();
-
-    void FindWayOnChaseState();
-
-    void FindWayOnScatterState();
-
-    void FindWayOnFrightenedState();
-
-    void FindWay(const SelectDirectionMethod directionMethod, const SelectTargetMethod targetMethod);
-
-    MoveDirection SelectBestDirection(const CellIndex& currentCell, const CellIndex& targetCell,
-                                      const MoveDirection backDirection) const;
-
-    MoveDirection SelectRandomDirection(const CellIndex& currentCell, const MoveDirection backDirection) const;
-
-    CellIndex FindMoveTarget(const CellIndex& currentCell, const MoveDirection direction);
-
-    void SetupInkyClydeStartActions();
-
-    void SetupScheduler();
-
-    const AIInfo               mAIInfo;
-    GhostsArray                mGhosts;
-    size_t                     mCurrentGhost;
-    std::shared_ptr<IDrawable> mFrightenedDrawable;
-};
-
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <array>
+#include <vector>
+#include <cassert>
+
+#include "base.h"
+#include "game_typedefs.h"
+#include "actor_controller.h"
+#include "utils.h"
+#include "pcg32.h"
+
+namespace Pacman {
+
+class IDrawable;
+class Actor;
+class Ghost;
+class GameLoader;
+class Scheduler;
+class SpriteSheet;
+class Map;
+class DotsGrid;
+class PacmanController;
+class DistanceField;
+
+static const size_t kGhostsCount = 4;
+
+struct DirectionDiscard
+{
+    CellIndex mCell;
+    MoveDirection mDirection;
+};
+
+// the way of the direction selection in the chase and the scatter states
+enum class PathfindingMode : uint8_t
+{
+    Euclidean      = 0, // the neighbor nearest to the target in a straight line
+    DistanceFields = 1  // the shortest path to pacman and the scatter targets (others are euclidean)
+};
+
+struct AIInfo
+{
+    std::array<CellIndex, kGhostsCount> mScatterTargets;
+    uint64_t                            mScatterDuration;
+    uint64_t                            mScatterInterval;
+    std::vector<DirectionDiscard>       mDiscardCells;
+    uint64_t                            mFrightDuration;
+    Position                            mRespawn;
+    PathfindingMode                     mPathfinding;
+    uint64_t                            mRandomSeed; // 0 - the time of the game start
+};
+
+class AIController : public IActorController
+{
+public:
+
+    AIController(const Size actorSize, const SpriteSheet& spriteSheet);
+    AIController(const AIController&) = delete;
+    ~AIController() = default;
+
+    AIController& operator= (const AIController&) = delete;
+
+    void Update(const uint64_t dt);
+
+    Ghost& GetGhost(const GhostId ghostId) const;
+
+    Actor& GetGhostActor(const GhostId ghostId) const;
+
+    CellIndex GetScatterTarget(const GhostId ghostid) const;
+
+    void EnableFrightenedState();
+
+    void DisableFrightenedState();
+
+    void ResetState();
+
+    void OnGhostDead(const GhostId ghostId);
+
+    virtual void OnDirectionChanged(const MoveDirection newDirection);
+
+    virtual void OnTargetAchieved();
+
+private:
+
+    enum class SelectDirectionMethod
+    {
+        Best,
+        Random
+    };
+
+    enum class SelectTargetMethod
+    {
+        OwnBehavior,
+        Scatter
+    };
+
+    typedef std::array<std::unique_ptr<Ghost>, kGhostsCount> GhostsArray; 
+    typedef std::array<std::unique_ptr<DistanceField>, kGhostsCount> DistanceFieldsArray;
+    typedef std::array<Pcg32, kGhostsCount> RandomsArray;
+
+    // rebuild the field when pacman changes the cell
+    void UpdatePacmanField();
+
+    // nullptr if the fields are disabled or the target hasn't the field
+    const DistanceField* FindDistanceField(const CellIndex& targetCell) const;
+
+    GhostId GetCurrentGhostId() const;
+
+    Ghost& GetCurrentGhost() const;
+
+    void FindWayOnWaitState();
+
+    void FindWayOnLeaveHouse();
+
+    void FindWayOnChaseState();
+
+    void FindWayOnScatterState();
+
+    void FindWayOnFrightenedState();
+
+    void FindWay(const SelectDirectionMethod directionMethod, const SelectTargetMethod targetMethod);
+
+    MoveDirection SelectBestDirection(const CellIndex& currentCell, const CellIndex& targetCell,
+                                      const MoveDirection backDirection) const;
+
+    // uses the random stream of the current ghost
+    MoveDirection SelectRandomDirection(const CellIndex& currentCell, const MoveDirection backDirection);
+
+    // the next junction or the last cell before the wall (see NavGraph::GetMoveTarget)
+    CellIndex FindMoveTarget(const CellIndex& currentCell, const MoveDirection direction) const;
+
+    void SetupInkyClydeStartActions();
+
+    void SetupScheduler();
+
+    const AIInfo                   mAIInfo;
+    GhostsArray                    mGhosts;
+    std::unique_ptr<DistanceField> mPacmanField;
+    DistanceFieldsArray            mScatterFields;
+    RandomsArray                   mRandoms; // the stream per ghost, the ghosts don't affect each other
+    size_t                         mCurrentGhost;
+    std::shared_ptr<IDrawable>     mFrightenedDrawable;
+};
+
 } // Pacman namespace
\ No newline at end of file
@@ -1,36 +1,69 @@
-#include "common.h"
-
-namespace Pacman {
-
-CellIndex SelectNearestCell(const CellIndexArray& currentCellsIndices, const MoveDirection direction)
-{
-    CellIndex result = currentCellsIndices[0];
-
-    for (size_t i = 1; i < currentCellsIndices.size(); i++)
-    {
-        const CellIndex& cellIndex = currentCellsIndices[i];
-        switch (direction)
-        {
-        case MoveDirection::Left:
-            if (GetColumn(cellIndex) < GetColumn(result))
-                result = cellIndex;
-            break;
-        case MoveDirection::Right:
-            if (GetColumn(cellIndex) > GetColumn(result))
-                result = cellIndex;
-            break;
-        case MoveDirection::Up:
-            if (GetRow(cellIndex) < GetRow(result))
-                result = cellIndex;
-            break;
-        case MoveDirection::Down:
-            if (GetRow(cellIndex) > GetRow(result))
-                result = cellIndex;
-            break;
-        }
-    }
-
-    return result;
-}
-
+#include "common.h"
+
+#include <limits>
+
+#include "math.h"
+#include "map.h"
+
+namespace Pacman {
+
+CellIndex SelectNearestCell(const CellIndexArray& currentCellsIndices, const MoveDirection direction)
+{
+    CellIndex result = currentCellsIndices[0];
+
+    for (size_t i = 1; i < currentCellsIndices.size(); i++)
+    {
+        const CellIndex& cellIndex = currentCellsIndices[i];
+        switch (direction)
+        {
+        case MoveDirection::Left:
+            if (GetColumn(cellIndex) < GetColumn(result))
+                result = cellIndex;
+            break;
+        case MoveDirection::Right:
+            if (GetColumn(cellIndex) > GetColumn(result))
+                result = cellIndex;
+            break;
+        case MoveDirection::Up:
+            if (GetRow(cellIndex) < GetRow(result))
+                result = cellIndex;
+            break;
+        case MoveDirection::Down:
+            if (GetRow(cellIndex) > GetRow(result))
+                result = cellIndex;
+            break;
+        }
+    }
+
+    return result;
+}
+
+MoveDirection SelectNearestDirection(const Map& map, const CellIndex& currentCell, const CellIndex& targetCell,
+                                     const DirectionMask directions)
+{
+    const Position targetCellCenterPos = map.GetCellCenterPos(targetCell);
+    const Math::Vector2f targetPos = Math::Vector2f(static_cast<float>(targetCellCenterPos.GetX()),
+                                                    static_cast<float>(targetCellCenterPos.GetY()));
+
+    MoveDirection result = MoveDirection::None;
+    float minDistance = std::numeric_limits<float>::max();
+    for (const MoveDirection direction : kMoveDirections)
+    {
+        if ((directions & GetDirectionBit(direction)) != 0)
+        {
+            const Position cellCenterPos = map.GetCellCenterPos(GetNext(currentCell, direction));
+            const Math::Vector2f cellPos = Math::Vector2f(static_cast<float>(cellCenterPos.GetX()),
+                                                          static_cast<float>(cellCenterPos.GetY()));
+            const float distance = (targetPos - cellPos).Length();
+            if (distance < minDistance)
+            {
+                result = direction;
+                minDistance = distance;
+            }
+        }
+    }
+
+    return result;
+}
+
 } // Pacman namespace
\ No newline at end of file
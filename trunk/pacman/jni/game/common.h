@@ -1,63 +1,103 @@
-#pragma once
-
-#include "game_typedefs.h"
-
-namespace Pacman {
-
-// if cells count greater than 1 select nearest cell for the current direction
-// (for example: if direction is left, select one of the most left placed cells)
-CellIndex SelectNearestCell(const CellIndexArray& currentCellsIndices, const MoveDirection direction);
-
-static FORCEINLINE MoveDirection GetBackDirection(const MoveDirection direction)
-{
-    switch (direction)
-    {
-    case MoveDirection::Left:
-        return MoveDirection::Right;
-    case MoveDirection::Right:
-        return MoveDirection::Left;
-    case MoveDirection::Up:
-        return MoveDirection::Down;
-    case MoveDirection::Down:
-        return MoveDirection::Up;
-    default:
-        return MoveDirection::None;
-    }
-}
-
-static FORCEINLINE CellIndex GetNext(const CellIndex& current, const MoveDirection direction)
-{
-    switch (direction)
-    {
-    case MoveDirection::Left:
-        return CellIndex(GetRow(current), GetColumn(current) - 1);
-    case MoveDirection::Right:
-        return CellIndex(GetRow(current), GetColumn(current) + 1);
-    case MoveDirection::Up:
-        return CellIndex(GetRow(current) - 1, GetColumn(current));
-    case MoveDirection::Down:
-        return CellIndex(GetRow(current) + 1, GetColumn(current));
-    default:
-        return current;
-    }
-}
-
-static FORCEINLINE Position GetFuturePosition(const Position& current, const MoveDirection direction,
-                                              const Size wayLength)
-{
-    switch (direction)
-    {
-    case MoveDirection::Left:
-        return Position(current.GetX() - wayLength, current.GetY());
-    case MoveDirection::Right:
-        return Position(current.GetX() + wayLength, current.GetY());
-    case MoveDirection::Up:
-        return Position(current.GetX(), current.GetY() - wayLength);
-    case MoveDirection::Down:
-        return Position(current.GetX(), current.GetY() + wayLength);
-    default:
-        return current;
-    }
-}
-
+#pragma once
+
+#include "game_forwdecl.h"
+#include "game_typedefs.h"
+#include "utils.h"
+
+namespace Pacman {
+
+// set of the directions, the bit per direction (see GetDirectionBit)
+typedef uint8_t DirectionMask;
+
+// the order of the directions checks
+static const MoveDirection kMoveDirections[] = { MoveDirection::Left, MoveDirection::Right,
+                                                 MoveDirection::Up, MoveDirection::Down };
+
+// if cells count greater than 1 select nearest cell for the current direction
+// (for example: if direction is left, select one of the most left placed cells)
+CellIndex SelectNearestCell(const CellIndexArray& currentCellsIndices, const MoveDirection direction);
+
+// select the direction of the mask to the neighbor which is the nearest to the target in a straight line (walls are ignored)
+// the directions are checked in the kMoveDirections order, the first one wins the tie
+MoveDirection SelectNearestDirection(const Map& map, const CellIndex& currentCell, const CellIndex& targetCell,
+                                     const DirectionMask directions);
+
+static FORCEINLINE MoveDirection GetBackDirection(const MoveDirection direction)
+{
+    switch (direction)
+    {
+    case MoveDirection::Left:
+        return MoveDirection::Right;
+    case MoveDirection::Right:
+        return MoveDirection::Left;
+    case MoveDirection::Up:
+        return MoveDirection::Down;
+    case MoveDirection::Down:
+        return MoveDirection::Up;
+    default:
+        return MoveDirection::None;
+    }
+}
+
+static FORCEINLINE DirectionMask GetDirectionBit(const MoveDirection direction)
+{
+    return (direction == MoveDirection::None) ? 0 : static_cast<DirectionMask>(1 << (EnumCast(direction) - 1));
+}
+
+inline FORCEINLINE size_t GetDirectionsCount(const DirectionMask mask)
+{
+    return static_cast<size_t>(__builtin_popcount(mask));
+}
+
+// the index-th direction of the mask in the kMoveDirections order, None if the mask hasn't so many directions
+inline FORCEINLINE MoveDirection GetMaskDirection(const DirectionMask mask, size_t index)
+{
+    for (const MoveDirection direction : kMoveDirections)
+    {
+        if ((mask & GetDirectionBit(direction)) != 0)
+        {
+            if (index == 0)
+                return direction;
+            index--;
+        }
+    }
+
+    return MoveDirection::None;
+}
+
+static FORCEINLINE CellIndex GetNext(const CellIndex& current, const MoveDirection direction)
+{
+    switch (direction)
+    {
+    case MoveDirection::Left:
+        return CellIndex(GetRow(current), GetColumn(current) - 1);
+    case MoveDirection::Right:
+        return CellIndex(GetRow(current), GetColumn(current) + 1);
+    case MoveDirection::Up:
+        return CellIndex(GetRow(current) - 1, GetColumn(current));
+    case MoveDirection::Down:
+        return CellIndex(GetRow(current) + 1, GetColumn(current));
+    default:
+        return current;
+    }
+}
+
+static FORCEINLINE Position GetFuturePosition(const Position& current, const MoveDirection direction,
+                                              const Size wayLength)
+{
+    switch (direction)
+    {
+    case MoveDirection::Left:
+        return Position(current.GetX() - wayLength, current.GetY());
+    case MoveDirection::Right:
+        return Position(current.GetX() + wayLength, current.GetY());
+    case MoveDirection::Up:
+        return Position(current.GetX(), current.GetY() - wayLength);
+    case MoveDirection::Down:
+        return Position(current.GetX(), current.GetY() + wayLength);
+    default:
+        return current;
+    }
+}
+
 } // Pacman namespace
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "distance_field.h"
+
+#include <algorithm>
+
+#include "map.h"
+
+namespace Pacman {
+
+const uint32_t DistanceField::kUnreachable;
+
+DistanceField::DistanceField(const Map& map)
+    : mRowsCount(map.GetRowsCount()),
+      mColumnsCount(map.GetColumnsCount()),
+      mLeftTunnelExit((GetRow(map.GetLeftTunnelExit()) * map.GetColumnsCount()) + GetColumn(map.GetLeftTunnelExit())),
+      mRightTunnelExit((GetRow(map.GetRightTunnelExit()) * map.GetColumnsCount()) + GetColumn(map.GetRightTunnelExit())),
+      mIncomingDirections(static_cast<size_t>(map.GetRowsCount()) * map.GetColumnsCount(), 0),
+      mTarget(std::numeric_limits<CellIndex::value_t>::max(), std::numeric_limits<CellIndex::value_t>::max()), // not built
+      mDistances(mIncomingDirections.size(), kUnreachable),
+      mQueue(mIncomingDirections.size())
+{
+    for (CellIndex::value_t i = 0; i < mRowsCount; i++)
+    {
+        for (CellIndex::value_t j = 0; j < mColumnsCount; j++)
+        {
+            const CellIndex cell(i, j);
+            DirectionMask& incomingDirections = mIncomingDirections[GetCellOffset(cell)];
+            for (const MoveDirection direction : kMoveDirections)
+            {
+                const bool isInside = ((direction != MoveDirection::Left) || (j > 0)) &&
+                                      ((direction != MoveDirection::Right) || (j + 1 < mColumnsCount)) &&
+                                      ((direction != MoveDirection::Up) || (i > 0)) &&
+                                      ((direction != MoveDirection::Down) || (i + 1 < mRowsCount));
+                if (!isInside)
+                    continue;
+
+                // the door is passable from the bottom
+                const DirectionMask neighborDirections = map.GetPassableDirections(GetNext(cell, direction), true);
+                if ((neighborDirections & GetDirectionBit(GetBackDirection(direction))) != 0)
+                    incomingDirections |= GetDirectionBit(direction);
+            }
+        }
+    }
+}
+
+void DistanceField::Build(const CellIndex& target)
+{
+    std::fill(mDistances.begin(), mDistances.end(), kUnreachable);
+    mTarget = target;
+
+    // every cell is queued once, so the queue never wraps
+    size_t head = 0;
+    size_t tail = 0;
+    mDistances[GetCellOffset(target)] = 0;
+    mQueue[tail++] = static_cast<uint32_t>(GetCellOffset(target));
+
+    const auto visit = [this, &tail](const size_t offset, const uint32_t distance)
+    {
+        if (mDistances[offset] == kUnreachable)
+        {
+            mDistances[offset] = distance;
+            mQueue[tail++] = static_cast<uint32_t>(offset);
+        }
+    };
+
+    while (head < tail)
+    {
+        const size_t offset = mQueue[head++];
+        const uint32_t distance = mDistances[offset] + 1;
+        const DirectionMask incomingDirections = mIncomingDirections[offset];
+
+        if ((incomingDirections & GetDirectionBit(MoveDirection::Left)) != 0)
+            visit(offset - 1, distance);
+        if ((incomingDirections & GetDirectionBit(MoveDirection::Right)) != 0)
+            visit(offset + 1, distance);
+        if ((incomingDirections & GetDirectionBit(MoveDirection::Up)) != 0)
+            visit(offset - mColumnsCount, distance);
+        if ((incomingDirections & GetDirectionBit(MoveDirection::Down)) != 0)
+            visit(offset + mColumnsCount, distance);
+
+        // the actor leaving the tunnel exit appears at the other one
+        if (offset == mLeftTunnelExit)
+            visit(mRightTunnelExit, distance);
+        else if (offset == mRightTunnelExit)
+            visit(mLeftTunnelExit, distance);
+    }
+}
+
+MoveDirection DistanceField::SelectDirection(const CellIndex& cell, const DirectionMask directions) const
+{
+    // the neighbors offsets in the kMoveDirections order
+    const size_t offset = GetCellOffset(cell);
+    const size_t neighbors[] = { offset - 1, offset + 1, offset - mColumnsCount, offset + mColumnsCount };
+
+    MoveDirection result = MoveDirection::None;
+    uint32_t minDistance = kUnreachable;
+    for (size_t i = 0; i < 4; i++)
+    {
+        const MoveDirection direction = kMoveDirections[i];
+        if ((directions & GetDirectionBit(direction)) != 0)
+        {
+            const uint32_t distance = mDistances[neighbors[i]];
+            if (distance < minDistance)
+            {
+                result = direction;
+                minDistance = distance;
+            }
+        }
+    }
+
+    return result;
+}
+
+} // Pacman namespace
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <vector>
+#include <limits>
+
+#include "game_forwdecl.h"
+#include "game_typedefs.h"
+#include "common.h"
+
+namespace Pacman {
+
+// the path lengths in cells from every cell of the map to the target cell, the door is passable from the bottom
+// and the tunnel exits are linked to each other (as the actors move)
+class DistanceField
+{
+public:
+
+    static const uint32_t kUnreachable = std::numeric_limits<uint32_t>::max();
+
+    DistanceField() = delete;
+    // the map passability is cached and the buffers are allocated once, Build doesn't allocate
+    explicit DistanceField(const Map& map);
+    DistanceField(const DistanceField&) = delete;
+    ~DistanceField() = default;
+
+    DistanceField& operator= (const DistanceField&) = delete;
+
+    // breadth-first search from the target over the reversed moves
+    void Build(const CellIndex& target);
+
+    CellIndex GetTarget() const
+    {
+        return mTarget;
+    }
+
+    uint32_t GetDistance(const CellIndex& cell) const
+    {
+        return mDistances[GetCellOffset(cell)];
+    }
+
+    // the direction of the mask to the neighbor with the shortest path, None if the target can't be reached
+    // the directions are checked in the kMoveDirections order, the first one wins the tie
+    MoveDirection SelectDirection(const CellIndex& cell, const DirectionMask directions) const;
+
+private:
+
+    size_t GetCellOffset(const CellIndex& cell) const
+    {
+        return (GetRow(cell) * mColumnsCount) + GetColumn(cell);
+    }
+
+    const CellIndex::value_t   mRowsCount;
+    const CellIndex::value_t   mColumnsCount;
+    const size_t               mLeftTunnelExit;  // offsets
+    const size_t               mRightTunnelExit;
+    std::vector<DirectionMask> mIncomingDirections; // the directions to the neighbors which can move to the cell
+    CellIndex                  mTarget;
+    std::vector<uint32_t>      mDistances;
+    std::vector<uint32_t>      mQueue;
+};
+
+} // Pacman namespace
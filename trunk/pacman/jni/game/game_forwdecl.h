@@ -1,24 +1,24 @@
-#pragma once
-
-#include "engine_forwdecl.h"
-
-namespace Pacman {
-
-class IActorController;
-class Map;
-class GameLoader;
-class DotsGrid;
-class Scheduler;
-class PacmanController;
-class AIController;
-class SharedDataManager;
-class Actor;
-class Ghost;
-class DotsGrid;
-class IActorListener;
-struct AIInfo;
-class SharedDataContext;
-
-enum class DotType : uint8_t;
-
+#pragma once
+
+#include "engine_forwdecl.h"
+
+namespace Pacman {
+
+class IActorController;
+class Map;
+class NavGraph;
+class GameLoader;
+class DotsGrid;
+class Scheduler;
+class PacmanController;
+class AIController;
+class SharedDataManager;
+class Actor;
+class Ghost;
+class DotsGrid;
+class IActorListener;
+struct AIInfo;
+
+enum class DotType : uint8_t;
+
 } // Pacman namespace
\ No newline at end of file
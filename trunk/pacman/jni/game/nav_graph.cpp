@@ -0,0 +1,226 @@
+#include "nav_graph.h"
+
+#include <algorithm>
+
+#include "error.h"
+#include "map.h"
+
+namespace Pacman {
+
+// the cell above the door is entered from the door and it isn't in its passability mask, so it's the choice point too
+static FORCEINLINE bool IsNodeCell(const Map& map, const CellIndex& cell)
+{
+    if (map.GetCell(cell) != MapCellType::Empty)
+        return false;
+
+    const bool isAboveDoor = (GetRow(cell) + 1 < map.GetRowsCount()) && (map.GetCell(GetRow(cell) + 1, GetColumn(cell)) == MapCellType::Door);
+    return isAboveDoor || (GetDirectionsCount(map.GetPassableDirections(cell, true)) != 2);
+}
+
+// the only passable direction except the back one, None if the corridor splits or ends
+static FORCEINLINE MoveDirection GetCorridorDirection(const DirectionMask mask, const MoveDirection backDirection)
+{
+    const DirectionMask forwardMask = mask & ~GetDirectionBit(backDirection);
+    if (GetDirectionsCount(forwardMask) != 1)
+        return MoveDirection::None;
+
+    for (const MoveDirection direction : kMoveDirections)
+    {
+        if ((forwardMask & GetDirectionBit(direction)) != 0)
+            return direction;
+    }
+
+    return MoveDirection::None;
+}
+
+NavGraph::NavGraph(const Map& map)
+    : mRowsCount(map.GetRowsCount()),
+      mColumnsCount(map.GetColumnsCount()),
+      mMoveTargets(),
+      mCellsNodes(),
+      mNodes(),
+      mEdges(),
+      mEdgesCells(),
+      mDistances(),
+      mPrevEdges(),
+      mHeap()
+{
+    BuildMoveTargets(map);
+    BuildNodes(map);
+    BuildEdges(map);
+
+    mDistances.resize(mNodes.size());
+    mPrevEdges.resize(mNodes.size());
+    mHeap.reserve(mEdges.size() + 1); // the node is pushed once per the relaxed edge
+}
+
+uint32_t NavGraph::FindPath(const NodeIndex from, const NodeIndex to, std::vector<EdgeIndex>* path) const
+{
+    if (path != nullptr)
+        path->clear();
+
+    std::fill(mDistances.begin(), mDistances.end(), kInfiniteDistance);
+    std::fill(mPrevEdges.begin(), mPrevEdges.end(), kInvalidEdge);
+    mHeap.clear();
+
+    mDistances[from] = 0;
+    mHeap.push_back({ 0, from });
+    while (!mHeap.empty())
+    {
+        std::pop_heap(mHeap.begin(), mHeap.end());
+        const PathItem item = mHeap.back();
+        mHeap.pop_back();
+
+        if (item.mDistance > mDistances[item.mNode])
+            continue; // outdated item
+
+        if (item.mNode == to)
+            break;
+
+        for (const EdgeIndex edgeIndex : mNodes[item.mNode].mEdges)
+        {
+            if (edgeIndex == kInvalidEdge)
+                continue;
+
+            const NavEdge& edge = mEdges[edgeIndex];
+            const uint32_t distance = item.mDistance + edge.mLength;
+            if (distance < mDistances[edge.mTo])
+            {
+                mDistances[edge.mTo] = distance;
+                mPrevEdges[edge.mTo] = edgeIndex;
+                mHeap.push_back({ distance, edge.mTo });
+                std::push_heap(mHeap.begin(), mHeap.end());
+            }
+        }
+    }
+
+    if ((path != nullptr) && (mDistances[to] != kInfiniteDistance))
+    {
+        for (NodeIndex node = to; node != from; node = mEdges[mPrevEdges[node]].mFrom)
+            path->push_back(mPrevEdges[node]);
+
+        std::reverse(path->begin(), path->end());
+    }
+
+    return mDistances[to];
+}
+
+void NavGraph::BuildMoveTargets(const Map& map)
+{
+    mMoveTargets.resize(static_cast<size_t>(mRowsCount) * mColumnsCount * 4);
+
+    // the target of the cell is the neighbor or the neighbor's target, so the neighbor in the direction is filled first
+    const auto fillTarget = [this, &map](const CellIndex& cell, const MoveDirection direction)
+    {
+        CellIndex& target = mMoveTargets[(GetCellOffset(cell) * 4) + GetDirectionIndex(direction)];
+        const DirectionMask directionBit = GetDirectionBit(direction);
+        if ((map.GetPassableDirections(cell, false) & directionBit) == 0)
+        {
+            target = cell;
+            return;
+        }
+
+        const CellIndex next = GetNext(cell, direction);
+        const bool isStop = map.IsJunction(next) || ((map.GetPassableDirections(next, false) & directionBit) == 0);
+        target = isStop ? next : GetMoveTarget(next, direction);
+    };
+
+    for (CellIndex::value_t i = 0; i < mRowsCount; i++)
+    {
+        for (CellIndex::value_t j = 0; j < mColumnsCount; j++)
+        {
+            fillTarget(CellIndex(i, j), MoveDirection::Left);
+            fillTarget(CellIndex(i, j), MoveDirection::Up);
+            fillTarget(CellIndex(mRowsCount - i - 1, mColumnsCount - j - 1), MoveDirection::Right);
+            fillTarget(CellIndex(mRowsCount - i - 1, mColumnsCount - j - 1), MoveDirection::Down);
+        }
+    }
+}
+
+void NavGraph::BuildNodes(const Map& map)
+{
+    mCellsNodes.assign(static_cast<size_t>(mRowsCount) * mColumnsCount, kInvalidNode);
+    for (CellIndex::value_t i = 0; i < mRowsCount; i++)
+    {
+        for (CellIndex::value_t j = 0; j < mColumnsCount; j++)
+        {
+            const CellIndex cell(i, j);
+            if (!IsNodeCell(map, cell))
+                continue;
+
+            PACMAN_CHECK_ERROR2(mNodes.size() < kInvalidNode, "Too many navigation nodes");
+            mCellsNodes[GetCellOffset(cell)] = static_cast<NodeIndex>(mNodes.size());
+
+            NavNode node;
+            node.mCell = cell;
+            node.mEdges.fill(kInvalidEdge);
+            mNodes.push_back(node);
+        }
+    }
+}
+
+void NavGraph::BuildEdges(const Map& map)
+{
+    for (size_t nodeIndex = 0; nodeIndex < mNodes.size(); nodeIndex++)
+    {
+        const CellIndex nodeCell = mNodes[nodeIndex].mCell;
+        const DirectionMask nodeMask = map.GetPassableDirections(nodeCell, true);
+        for (const MoveDirection startDirection : kMoveDirections)
+        {
+            if ((nodeMask & GetDirectionBit(startDirection)) == 0)
+                continue;
+
+            const size_t cellsBegin = mEdgesCells.size();
+            MoveDirection direction = startDirection;
+            CellIndex cell = GetNext(nodeCell, direction);
+            mEdgesCells.push_back(cell);
+
+            // follow the corridor corners up to the next node, the corridor cells have the single way forward
+            while (GetNodeIndex(cell) == kInvalidNode)
+            {
+                direction = GetCorridorDirection(map.GetPassableDirections(cell, true), GetBackDirection(direction));
+                if (direction == MoveDirection::None)
+                    break;
+
+                cell = GetNext(cell, direction);
+                mEdgesCells.push_back(cell);
+            }
+
+            const NodeIndex toNode = GetNodeIndex(cell);
+            if (toNode == kInvalidNode)
+            {
+                mEdgesCells.resize(cellsBegin);
+                continue;
+            }
+
+            PACMAN_CHECK_ERROR2(mEdges.size() < kInvalidEdge, "Too many navigation edges");
+            const uint32_t cellsCount = static_cast<uint32_t>(mEdgesCells.size() - cellsBegin);
+            const NavEdge edge = { static_cast<NodeIndex>(nodeIndex), toNode, cellsCount, static_cast<uint32_t>(cellsBegin),
+                                   cellsCount, startDirection, direction, false };
+
+            mNodes[nodeIndex].mEdges[GetDirectionIndex(startDirection)] = static_cast<EdgeIndex>(mEdges.size());
+            mEdges.push_back(edge);
+        }
+    }
+
+    AddTunnelEdge(map.GetLeftTunnelExit(), map.GetRightTunnelExit(), MoveDirection::Left);
+    AddTunnelEdge(map.GetRightTunnelExit(), map.GetLeftTunnelExit(), MoveDirection::Right);
+}
+
+void NavGraph::AddTunnelEdge(const CellIndex& from, const CellIndex& to, const MoveDirection direction)
+{
+    const NodeIndex fromNode = GetNodeIndex(from);
+    const NodeIndex toNode = GetNodeIndex(to);
+    PACMAN_CHECK_ERROR2((fromNode != kInvalidNode) && (toNode != kInvalidNode), "Tunnel exit isn't the dead end");
+
+    NavNode& node = mNodes[fromNode];
+    PACMAN_CHECK_ERROR2(node.mEdges[GetDirectionIndex(direction)] == kInvalidEdge, "Tunnel exit isn't on the map border");
+    PACMAN_CHECK_ERROR2(mEdges.size() < kInvalidEdge, "Too many navigation edges");
+
+    // the actor is translated between the exits, it's the single step
+    const NavEdge edge = { fromNode, toNode, 1, static_cast<uint32_t>(mEdgesCells.size()), 0, direction, direction, true };
+    node.mEdges[GetDirectionIndex(direction)] = static_cast<EdgeIndex>(mEdges.size());
+    mEdges.push_back(edge);
+}
+
+} // Pacman namespace
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <limits>
+
+#include "game_forwdecl.h"
+#include "game_typedefs.h"
+#include "common.h"
+
+namespace Pacman {
+
+typedef uint16_t NodeIndex;
+typedef uint16_t EdgeIndex;
+
+static const NodeIndex kInvalidNode = std::numeric_limits<NodeIndex>::max();
+static const EdgeIndex kInvalidEdge = std::numeric_limits<EdgeIndex>::max();
+static const uint32_t  kInfiniteDistance = std::numeric_limits<uint32_t>::max();
+
+// the cell where the way splits or ends (the junction, the dead end or the tunnel exit)
+struct NavNode
+{
+    CellIndex                mCell;
+    std::array<EdgeIndex, 4> mEdges; // outgoing edges indexed by the direction bit index, kInvalidEdge if the way is blocked
+};
+
+// the corridor from one node to another, the edges are directed (the door is passable from the bottom to the top only)
+struct NavEdge
+{
+    NodeIndex     mFrom;
+    NodeIndex     mTo;
+    uint32_t      mLength;         // in cells
+    uint32_t      mCellsBegin;     // the cells from the first one after mFrom to mTo inclusive (see GetEdgeCells)
+    uint32_t      mCellsCount;     // it's 0 for the tunnel
+    MoveDirection mStartDirection; // the direction of leaving mFrom
+    MoveDirection mEndDirection;   // the direction of entering mTo (corners turn the corridor)
+    bool          mIsTunnel;
+};
+
+// navigation graph of the map, it's built once at the load time
+class NavGraph
+{
+public:
+
+    NavGraph() = delete;
+    explicit NavGraph(const Map& map);
+    NavGraph(const NavGraph&) = delete;
+    ~NavGraph() = default;
+
+    NavGraph& operator= (const NavGraph&) = delete;
+
+    // the cell where the actor moving from the cell in the direction stops: the next junction
+    // or the last cell before the way is blocked (the door isn't passed)
+    CellIndex GetMoveTarget(const CellIndex& cell, const MoveDirection direction) const
+    {
+        return mMoveTargets[(GetCellOffset(cell) * 4) + GetDirectionIndex(direction)];
+    }
+
+    // kInvalidNode if the cell isn't a node
+    NodeIndex GetNodeIndex(const CellIndex& cell) const
+    {
+        return mCellsNodes[GetCellOffset(cell)];
+    }
+
+    size_t GetNodesCount() const
+    {
+        return mNodes.size();
+    }
+
+    size_t GetEdgesCount() const
+    {
+        return mEdges.size();
+    }
+
+    const NavNode& GetNode(const NodeIndex index) const
+    {
+        return mNodes[index];
+    }
+
+    const NavEdge& GetEdge(const EdgeIndex index) const
+    {
+        return mEdges[index];
+    }
+
+    const CellIndex* GetEdgeCells(const NavEdge& edge) const
+    {
+        return mEdgesCells.data() + edge.mCellsBegin;
+    }
+
+    // the shortest path length in cells, kInfiniteDistance if the node can't be reached
+    // path - the edges from the start node to the end one, can be nullptr
+    // it doesn't allocate if the path capacity is enough
+    uint32_t FindPath(const NodeIndex from, const NodeIndex to, std::vector<EdgeIndex>* path) const;
+
+private:
+
+    static size_t GetDirectionIndex(const MoveDirection direction)
+    {
+        return static_cast<size_t>(EnumCast(direction) - 1);
+    }
+
+    size_t GetCellOffset(const CellIndex& cell) const
+    {
+        return (GetRow(cell) * mColumnsCount) + GetColumn(cell);
+    }
+
+    void BuildMoveTargets(const Map& map);
+
+    void BuildNodes(const Map& map);
+
+    void BuildEdges(const Map& map);
+
+    void AddTunnelEdge(const CellIndex& from, const CellIndex& to, const MoveDirection direction);
+
+    struct PathItem
+    {
+        uint32_t  mDistance;
+        NodeIndex mNode;
+
+        bool operator< (const PathItem& other) const
+        {
+            return mDistance > other.mDistance; // min-heap
+        }
+    };
+
+    const CellIndex::value_t mRowsCount;
+    const CellIndex::value_t mColumnsCount;
+    std::vector<CellIndex>   mMoveTargets; // 4 per cell
+    std::vector<NodeIndex>   mCellsNodes;
+    std::vector<NavNode>     mNodes;
+    std::vector<NavEdge>     mEdges;
+    std::vector<CellIndex>   mEdgesCells;
+
+    // the path search buffers, they are allocated once
+    mutable std::vector<uint32_t>  mDistances;
+    mutable std::vector<EdgeIndex> mPrevEdges;
+    mutable std::vector<PathItem>  mHeap;
+};
+
+} // Pacman namespace
@@ -1,82 +1,120 @@
-#include "scheduler.h"
-
-namespace Pacman {
-
-void Scheduler::UpdateEvents(const uint64_t dt)
-{
-    for (EventData& eventData : mEvents)
-    {
-        eventData.mElapsedInterval += dt;
-        if (eventData.mElapsedInterval >= eventData.mDelay)
-        {
-            eventData.mElapsedInterval = 0;
-            const ActionResult result = eventData.mAction();
-            if ((!eventData.mRepeatable) || (result == ActionResult::Unregister))
-                UnregisterEvent(eventData.mActionId);
-        }
-    }
-
-    CleanupEvents();
-}
-
-void Scheduler::UpdateTriggers()
-{
-    for (TriggerData& triggerData : mTriggers)
-    {
-        const ActionResult result = triggerData.mAction();
-        if (result == ActionResult::Unregister)
-            UnregisterTrigger(triggerData.mActionId);
-    }
-
-    CleanupTriggers();
-}
-
-void Scheduler::RegisterEvent(const Action& action, const uint64_t delay, const bool repeatable)
-{
-    static uint64_t actionIdCounter = 0;
-    mEvents.push_back(EventData { delay, 0, actionIdCounter++, repeatable, action });
-}
-
-void Scheduler::RegisterTrigger(const Action& action)
-{
-    static uint64_t actionIdCounter = 0;
-    mTriggers.push_back(TriggerData { actionIdCounter++, action });
-}
-
-void Scheduler::UnregisterEvent(const uint64_t actionId)
-{
-    mUnregisteredEvents.push_back(actionId);
-}
-
-void Scheduler::UnregisterTrigger(const uint64_t actionId)
-{
-    mUnregisteredTriggers.push_back(actionId);
-}
-
-void Scheduler::CleanupEvents()
-{
-    for (const uint64_t actionId : mUnregisteredEvents)
-    {
-        mEvents.remove_if([actionId](const EventData& eventData)
-        {
-            return eventData.mActionId == actionId;
-        });    
-    }
-
-    mUnregisteredEvents.clear();
-}
-
-void Scheduler::CleanupTriggers()
-{
-    for (const uint64_t actionId : mUnregisteredTriggers)
-    {
-        mTriggers.remove_if([actionId](const TriggerData& triggerData)
-        {
-            return triggerData.mActionId == actionId;
-        });    
-    }
-
-    mUnregisteredTriggers.clear();
-}
-
+#include "scheduler.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "profiler.h"
+
+namespace Pacman {
+
+static const size_t kReservedActionsCount = 32;
+
+Scheduler::Scheduler()
+{
+    mEvents.reserve(kReservedActionsCount);
+    mTriggers.reserve(kReservedActionsCount);
+    mRegisteredEvents.reserve(kReservedActionsCount);
+    mRegisteredTriggers.reserve(kReservedActionsCount);
+    mUnregisteredEvents.reserve(kReservedActionsCount);
+    mUnregisteredTriggers.reserve(kReservedActionsCount);
+}
+
+void Scheduler::UpdateEvents(const uint64_t dt)
+{
+    PACMAN_PROFILE_SCOPE("Scheduler.Events");
+
+    AddRegisteredEvents();
+    for (EventData& eventData : mEvents)
+    {
+        eventData.mElapsedInterval += dt;
+        if (eventData.mElapsedInterval >= eventData.mDelay)
+        {
+            eventData.mElapsedInterval = 0;
+            const ActionResult result = eventData.mAction();
+            if ((!eventData.mRepeatable) || (result == ActionResult::Unregister))
+                UnregisterEvent(eventData.mActionId);
+        }
+    }
+
+    CleanupEvents();
+}
+
+void Scheduler::UpdateTriggers()
+{
+    PACMAN_PROFILE_SCOPE("Scheduler.Triggers");
+
+    AddRegisteredTriggers();
+    for (TriggerData& triggerData : mTriggers)
+    {
+        const ActionResult result = triggerData.mAction();
+        if (result == ActionResult::Unregister)
+            UnregisterTrigger(triggerData.mActionId);
+    }
+
+    CleanupTriggers();
+}
+
+void Scheduler::RegisterEvent(const Action& action, const uint64_t delay, const bool repeatable)
+{
+    static uint64_t actionIdCounter = 0;
+    mRegisteredEvents.push_back(EventData { delay, 0, actionIdCounter++, repeatable, action });
+}
+
+void Scheduler::RegisterTrigger(const Action& action)
+{
+    static uint64_t actionIdCounter = 0;
+    mRegisteredTriggers.push_back(TriggerData { actionIdCounter++, action });
+}
+
+void Scheduler::UnregisterEvent(const uint64_t actionId)
+{
+    mUnregisteredEvents.push_back(actionId);
+}
+
+void Scheduler::UnregisterTrigger(const uint64_t actionId)
+{
+    mUnregisteredTriggers.push_back(actionId);
+}
+
+void Scheduler::CleanupEvents()
+{
+    for (const uint64_t actionId : mUnregisteredEvents)
+    {
+        mEvents.erase(std::remove_if(mEvents.begin(), mEvents.end(), [actionId](const EventData& eventData)
+        {
+            return eventData.mActionId == actionId;
+        }), mEvents.end());
+    }
+
+    mUnregisteredEvents.clear();
+}
+
+void Scheduler::CleanupTriggers()
+{
+    for (const uint64_t actionId : mUnregisteredTriggers)
+    {
+        mTriggers.erase(std::remove_if(mTriggers.begin(), mTriggers.end(), [actionId](const TriggerData& triggerData)
+        {
+            return triggerData.mActionId == actionId;
+        }), mTriggers.end());
+    }
+
+    mUnregisteredTriggers.clear();
+}
+
+void Scheduler::AddRegisteredEvents()
+{
+    // moved, the copy of the action can allocate
+    mEvents.insert(mEvents.end(), std::make_move_iterator(mRegisteredEvents.begin()),
+                   std::make_move_iterator(mRegisteredEvents.end()));
+    mRegisteredEvents.clear();
+}
+
+void Scheduler::AddRegisteredTriggers()
+{
+    mTriggers.insert(mTriggers.end(), std::make_move_iterator(mRegisteredTriggers.begin()),
+                     std::make_move_iterator(mRegisteredTriggers.end()));
+    mRegisteredTriggers.clear();
+}
+
 } // Pacman namespace
\ No newline at end of file
@@ -1,70 +1,54 @@
-#include "shared_data_manager.h"
-
-#include "shared_data_context.h"
-#include "game.h"
-#include "map.h"
-#include "actor.h"
-#include "pacman_controller.h"
-#include "ai_controller.h"
-#include "ghosts_factory.h"
-#include "ghost.h"
-
-namespace Pacman {
-
-static FORCEINLINE std::string GetGhostKeyName(const GhostId ghostId)
-{
-    switch (ghostId)
-    {
-    case GhostId::Blinky:
-        return "blinkyCells";
-    case GhostId::Pinky:
-        return "inkyCells";
-    case GhostId::Inky:
-        return "pinkyCells";
-    case GhostId::Clyde:
-        return "clydeCells";
-    }
-}
-
-SharedDataManager::SharedDataManager()
-                 : mContext(new SharedDataContext())
-{
-}
-
-SharedDataManager::~SharedDataManager()
-{
-}
-
-void SharedDataManager::Reset()
-{
-    mContext->Reset();
-}
-
-CellIndexArray SharedDataManager::GetPacmanCells()
-{
-    static const std::string kKey = "pacmanCells";
-    return GetActorCells(GetGame().GetPacmanController().GetActor(), kKey);
-}
-
-CellIndexArray SharedDataManager::GetGhostCells(const GhostId ghostId)
-{
-    return GetActorCells(GetGame().GetAIController().GetGhostActor(ghostId), GetGhostKeyName(ghostId));
-}
-
-CellIndexArray SharedDataManager::GetActorCells(const Actor& actor, const std::string& keyName)
-{
-    if (mContext->HasValue(keyName))
-    {
-        return mContext->GetValue<CellIndexArray>(keyName);
-    }
-    else
-    {
-        Game& game = GetGame();
-        Map& map = game.GetMap();
-        const CellIndexArray cells = map.FindCells(actor.GetRegion());
-        mContext->SetValue(keyName, cells);
-        return cells;
-    }
-}
-
-} // Pacman namespace
\ No newline at end of file
+#include "shared_data_manager.h"
+
+#include "game.h"
+#include "map.h"
+#include "actor.h"
+#include "pacman_controller.h"
+#include "ai_controller.h"
+#include "utils.h"
+
+namespace Pacman {
+
+SharedDataManager::SharedDataManager()
+                 : mFrame(1)
+{
+    static_assert(kPacmanSlot == kGhostsCount, "Each ghost should have its own slot");
+
+    for (ActorCells& actorCells : mActorsCells)
+        actorCells.mFrame = 0;
+}
+
+void SharedDataManager::Reset()
+{
+    // the old frames values can't match the counter after its overflow
+    if (++mFrame == 0)
+    {
+        for (ActorCells& actorCells : mActorsCells)
+            actorCells.mFrame = 0;
+        mFrame = 1;
+    }
+}
+
+const CellIndexArray& SharedDataManager::GetPacmanCells()
+{
+    return GetActorCells(GetGame().GetPacmanController().GetActor(), kPacmanSlot);
+}
+
+const CellIndexArray& SharedDataManager::GetGhostCells(const GhostId ghostId)
+{
+    return GetActorCells(GetGame().GetAIController().GetGhostActor(ghostId), EnumCast(ghostId));
+}
+
+const CellIndexArray& SharedDataManager::GetActorCells(const Actor& actor, const size_t slot)
+{
+    ActorCells& actorCells = mActorsCells[slot];
+    if (actorCells.mFrame != mFrame)
+    {
+        actorCells.mCells = GetGame().GetMap().FindCells(actor.GetRegion());
+        actorCells.mFrame = mFrame;
+    }
+
+    return actorCells.mCells;
+}
+
+} // Pacman namespace
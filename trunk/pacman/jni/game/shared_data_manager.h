@@ -1,33 +1,47 @@
-#pragma once
-
-#include <memory>
-
-#include "game_forwdecl.h"
-#include "game_typedefs.h"
-
-namespace Pacman {
-
-class SharedDataManager
-{
-public:
-
-    SharedDataManager();
-    SharedDataManager(const SharedDataManager&) = delete;
-    ~SharedDataManager();
-
-    SharedDataManager& operator= (const SharedDataManager&) = delete;
-
-    void Reset();
-
-    CellIndexArray GetPacmanCells();
-
-    CellIndexArray GetGhostCells(const GhostId ghostId);
-
-private:
-
-    CellIndexArray GetActorCells(const Actor& actor, const std::string& keyName);
-
-    std::unique_ptr<SharedDataContext> mContext;
-};
-
-} // Pacman namespace
\ No newline at end of file
+#pragma once
+
+#include <array>
+
+#include "game_forwdecl.h"
+#include "game_typedefs.h"
+
+namespace Pacman {
+
+// per-frame cache of the cells where the actors are placed, the cells are found once per frame on the first query
+class SharedDataManager
+{
+public:
+
+    SharedDataManager();
+    SharedDataManager(const SharedDataManager&) = delete;
+    ~SharedDataManager() = default;
+
+    SharedDataManager& operator= (const SharedDataManager&) = delete;
+
+    // invalidates the cached cells, it's called at the frame end
+    void Reset();
+
+    // the reference is valid until the Reset call
+    const CellIndexArray& GetPacmanCells();
+
+    const CellIndexArray& GetGhostCells(const GhostId ghostId);
+
+private:
+
+    // the ghosts slots are indexed by the GhostId, pacman has the last one
+    static const size_t kActorsCount = 5;
+    static const size_t kPacmanSlot = kActorsCount - 1;
+
+    struct ActorCells
+    {
+        CellIndexArray mCells;
+        uint32_t       mFrame; // the cells are valid if it's equal to the current frame
+    };
+
+    const CellIndexArray& GetActorCells(const Actor& actor, const size_t slot);
+
+    std::array<ActorCells, kActorsCount> mActorsCells;
+    uint32_t                             mFrame;
+};
+
+} // Pacman namespace
@@ -0,0 +1,48 @@
+#include "gl_wrapper.h"
+
+namespace Pacman {
+namespace GL {
+
+static GLCounters gFrameCounters = {};
+
+GLCounters& GetFrameCounters()
+{
+    return gFrameCounters;
+}
+
+size_t GetTexImageSize(const GLsizei width, const GLsizei height, const GLenum format, const GLenum type)
+{
+    size_t pixelSize = 0;
+    switch (type)
+    {
+    case GL_UNSIGNED_SHORT_5_6_5:
+    case GL_UNSIGNED_SHORT_4_4_4_4:
+    case GL_UNSIGNED_SHORT_5_5_5_1:
+        pixelSize = 2;
+        break;
+    case GL_UNSIGNED_BYTE:
+        switch (format)
+        {
+        case GL_RGBA:
+            pixelSize = 4;
+            break;
+        case GL_RGB:
+            pixelSize = 3;
+            break;
+        case GL_LUMINANCE_ALPHA:
+            pixelSize = 2;
+            break;
+        default:
+            pixelSize = 1;
+            break;
+        }
+        break;
+    default:
+        break;
+    }
+
+    return static_cast<size_t>(width) * static_cast<size_t>(height) * pixelSize;
+}
+
+} // GL namespace
+} // Pacman namespace
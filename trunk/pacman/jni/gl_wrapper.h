@@ -0,0 +1,166 @@
+#pragma once
+
+#include <GLES2/gl2.h>
+#include <array>
+
+#include "base.h"
+#include "utils.h"
+
+namespace Pacman {
+
+// driver work of the frame, counted by the GL wrappers
+// (the buffer and vertex array binds are counted by the VertexLayoutCache, it calls the GL through its api)
+enum class GLCounter
+{
+    DrawCalls,
+    Triangles,
+    BufferBinds,
+    VertexArrayBinds,
+    TextureBinds,
+    ProgramSwitches,
+    UniformUploads,
+    BlendToggles,
+    UploadedBytes // glBufferData, glBufferSubData, glTexImage2D, glCompressedTexImage2D
+};
+
+static const size_t kGLCountersCount = 9;
+
+typedef std::array<size_t, kGLCountersCount> GLCounters;
+
+namespace GL {
+
+// the counters since the last RenderStats::EndFrame (the render thread only)
+GLCounters& GetFrameCounters();
+
+size_t GetTexImageSize(const GLsizei width, const GLsizei height, const GLenum format, const GLenum type);
+
+inline FORCEINLINE void Count(const GLCounter counter, const size_t value = 1)
+{
+    GetFrameCounters()[EnumCast(counter)] += value;
+}
+
+inline FORCEINLINE void DrawElements(const GLenum mode, const GLsizei count, const GLenum type, const GLvoid* indices)
+{
+    Count(GLCounter::DrawCalls);
+    if (mode == GL_TRIANGLES)
+        Count(GLCounter::Triangles, count / 3);
+
+    glDrawElements(mode, count, type, indices);
+}
+
+inline FORCEINLINE void BufferData(const GLenum target, const GLsizeiptr size, const GLvoid* data, const GLenum usage)
+{
+    if (data != nullptr)
+        Count(GLCounter::UploadedBytes, size);
+
+    glBufferData(target, size, data, usage);
+}
+
+inline FORCEINLINE void BufferSubData(const GLenum target, const GLintptr offset, const GLsizeiptr size, const GLvoid* data)
+{
+    Count(GLCounter::UploadedBytes, size);
+    glBufferSubData(target, offset, size, data);
+}
+
+inline FORCEINLINE void BindTexture(const GLenum target, const GLuint texture)
+{
+    Count(GLCounter::TextureBinds);
+    glBindTexture(target, texture);
+}
+
+inline FORCEINLINE void TexImage2D(const GLenum target, const GLint level, const GLint internalFormat, const GLsizei width,
+                                   const GLsizei height, const GLint border, const GLenum format, const GLenum type, const GLvoid* pixels)
+{
+    if (pixels != nullptr)
+        Count(GLCounter::UploadedBytes, GetTexImageSize(width, height, format, type));
+
+    glTexImage2D(target, level, internalFormat, width, height, border, format, type, pixels);
+}
+
+inline FORCEINLINE void CompressedTexImage2D(const GLenum target, const GLint level, const GLenum internalFormat, const GLsizei width,
+                                             const GLsizei height, const GLint border, const GLsizei imageSize, const GLvoid* data)
+{
+    Count(GLCounter::UploadedBytes, imageSize);
+    glCompressedTexImage2D(target, level, internalFormat, width, height, border, imageSize, data);
+}
+
+inline FORCEINLINE void UseProgram(const GLuint program)
+{
+    Count(GLCounter::ProgramSwitches);
+    glUseProgram(program);
+}
+
+inline FORCEINLINE void Enable(const GLenum cap)
+{
+    if (cap == GL_BLEND)
+        Count(GLCounter::BlendToggles);
+
+    glEnable(cap);
+}
+
+inline FORCEINLINE void Disable(const GLenum cap)
+{
+    if (cap == GL_BLEND)
+        Count(GLCounter::BlendToggles);
+
+    glDisable(cap);
+}
+
+// the uniforms uploads
+
+inline FORCEINLINE void Uniform1f(const GLint location, const GLfloat value)
+{
+    Count(GLCounter::UniformUploads);
+    glUniform1f(location, value);
+}
+
+inline FORCEINLINE void Uniform1i(const GLint location, const GLint value)
+{
+    Count(GLCounter::UniformUploads);
+    glUniform1i(location, value);
+}
+
+inline FORCEINLINE void Uniform2fv(const GLint location, const GLsizei count, const GLfloat* value)
+{
+    Count(GLCounter::UniformUploads);
+    glUniform2fv(location, count, value);
+}
+
+inline FORCEINLINE void Uniform3fv(const GLint location, const GLsizei count, const GLfloat* value)
+{
+    Count(GLCounter::UniformUploads);
+    glUniform3fv(location, count, value);
+}
+
+inline FORCEINLINE void Uniform4fv(const GLint location, const GLsizei count, const GLfloat* value)
+{
+    Count(GLCounter::UniformUploads);
+    glUniform4fv(location, count, value);
+}
+
+inline FORCEINLINE void Uniform2iv(const GLint location, const GLsizei count, const GLint* value)
+{
+    Count(GLCounter::UniformUploads);
+    glUniform2iv(location, count, value);
+}
+
+inline FORCEINLINE void Uniform3iv(const GLint location, const GLsizei count, const GLint* value)
+{
+    Count(GLCounter::UniformUploads);
+    glUniform3iv(location, count, value);
+}
+
+inline FORCEINLINE void Uniform4iv(const GLint location, const GLsizei count, const GLint* value)
+{
+    Count(GLCounter::UniformUploads);
+    glUniform4iv(location, count, value);
+}
+
+inline FORCEINLINE void UniformMatrix4fv(const GLint location, const GLsizei count, const GLboolean transpose, const GLfloat* value)
+{
+    Count(GLCounter::UniformUploads);
+    glUniformMatrix4fv(location, count, transpose, value);
+}
+
+} // GL namespace
+} // Pacman namespace
@@ -1,254 +1,357 @@
-#include "instanced_sprite.h"
-
-#include "error.h"
-#include "texture.h"
-#include "vertex_buffer.h"
-#include "shader_program.h"
-
-namespace Pacman {
-
-static const size_t kSpriteVertexCount = 4;
-static const uint16_t kSpriteIndexCount = 6;
-static const Color kDefaultColor = Color::kGreen;
-static const TextureRegion kDefaultRegion = TextureRegion(Math::Vector2f::kZero, 1.0f, 1.0f);
-
-template <typename VertexT>
-static FORCEINLINE void FillSpriteVertex(VertexT& vertex, const VertexT& baseVertex, const Position& position)
-{
-    vertex = baseVertex;
-    vertex.x += position.GetX();
-    vertex.y += position.GetY();
-}
-
-template <typename VertexT>
-static void FillVertexData(const SpriteRegion& region, const std::vector<Position>& positions,
-                           std::vector<VertexT>& vertices, std::vector<uint16_t>& indices)
-{
-    //                  base sprite
-    //                           	____
-    // 				 |\          	\ 	|  
-    // 	 	 	 |	 | \    ^    | 	 \ 	|  ^
-    // 	 	 	 v	 |  \   | +  v	  \	|  |
-    // 	 	 	 	 |___\        	   \|
-    //				   ->             ->
-
-    static const std::array<uint16_t, kSpriteIndexCount> kBaseIndices = { 0, 1, 2, 0, 2, 3 };
-    std::array<VertexT, kSpriteVertexCount> baseVertices;
-
-    // fiil base position data
-    baseVertices[0].x = region.GetPosX();
-    baseVertices[0].y = region.GetPosY();
-
-    baseVertices[1].x = region.GetLeftBottomPosX();
-    baseVertices[1].y = region.GetLeftBottomPosY();
-
-    baseVertices[2].x = region.GetRightBottomPosX();
-    baseVertices[2].y = region.GetRightBottomPosY();
-
-    baseVertices[3].x = region.GetRightTopPosX();
-    baseVertices[3].y = region.GetRightTopPosY();
-
-    // resize vectors to data size
-    vertices.resize(kSpriteVertexCount * positions.size());
-    indices.resize(kSpriteIndexCount * positions.size());
-
-    // fill position data
-    for (size_t i = 0; i < positions.size(); i++)
-    {
-        const Position& pos = positions[i];
-        for (size_t j = 0; j < kSpriteVertexCount; j++)
-        {
-            VertexT& vertex = vertices[i*kSpriteVertexCount + j];
-            FillSpriteVertex(vertex, baseVertices[j], pos);
-        }
-    }
-
-    // fill index data
-    for (size_t i = 0; i < positions.size(); i++)
-    {
-        for (size_t j = 0; j < kSpriteIndexCount; j++)
-        {
-            indices[i*kSpriteIndexCount + j] = kBaseIndices[j] + i*kSpriteVertexCount;
-        }
-    }
-}
-
-static FORCEINLINE void FillColor(ColorVertex& vertex, const Color color)
-{
-    vertex.r = color.GetRedFloat();
-    vertex.g = color.GetGreenFloat();
-    vertex.b = color.GetBlueFloat();
-    vertex.a = color.GetAlphaFloat();
-}
-
-static FORCEINLINE void FillTexCoord(TextureVertex& vertex, const Math::Vector2f& texCoord)
-{
-    vertex.u = texCoord.GetX();
-    vertex.v = texCoord.GetY();
-}
-
-//===========================================================================================================
-
-InstancedSprite::InstancedSprite(const SpriteRegion& region, const Color leftTop, const Color rightTop, const Color leftBottom,
-			                     const Color rightBottom, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend,
-                                 const std::vector<Position>& instances, const bool instanceEraseEnabled)
-	           : mShaderProgram(std::move(shaderProgram)),
-	             mTexture(nullptr),
-		         mVertexBuffer(nullptr),
-		         mAlphaBlend(alphaBlend),
-                 mInstanceEraseEnabled(instanceEraseEnabled),
-                 mInstancesCount(instances.size())
-{
-	InitByColor(region, leftTop, rightTop, leftBottom, rightBottom, instances);
-    InitInstancesEraseState();
-}
-
-InstancedSprite::InstancedSprite(const SpriteRegion& region, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend,
-                                 const std::vector<Position>& instances, const bool instanceEraseEnabled)
-	           : mShaderProgram(std::move(shaderProgram)),
-	             mTexture(nullptr),
-		         mVertexBuffer(nullptr),
-		         mAlphaBlend(alphaBlend),
-                 mInstanceEraseEnabled(instanceEraseEnabled),
-                 mInstancesCount(instances.size())
-{
-	InitByColor(region, kDefaultColor, kDefaultColor, kDefaultColor, kDefaultColor, instances);
-    InitInstancesEraseState();
-}
-
-InstancedSprite::InstancedSprite(const SpriteRegion& region, const TextureRegion& textureRegion, const std::shared_ptr<Texture2D> texture,
-			                     const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend, const std::vector<Position>& instances,
-                                 const bool instanceEraseEnabled)
-	           : mShaderProgram(std::move(shaderProgram)),
-	             mTexture(std::move(texture)),
-		         mVertexBuffer(nullptr),
-		         mAlphaBlend(alphaBlend),
-                 mInstanceEraseEnabled(instanceEraseEnabled),
-                 mInstancesCount(instances.size())
-{
-	InitByTexture(region, textureRegion, instances);
-    InitInstancesEraseState();
-}
-
-InstancedSprite::InstancedSprite(const SpriteRegion& region, const std::shared_ptr<Texture2D> texture, const std::shared_ptr<ShaderProgram> shaderProgram,
-                                 const bool alphaBlend, const std::vector<Position>& instances, const bool instanceEraseEnabled)
-	           : mShaderProgram(std::move(shaderProgram)),
-	             mTexture(std::move(texture)),
-		         mVertexBuffer(nullptr),
-		         mAlphaBlend(alphaBlend),
-                 mInstanceEraseEnabled(instanceEraseEnabled),
-                 mInstancesCount(instances.size())
-{
-	InitByTexture(region, kDefaultRegion, instances);
-    InitInstancesEraseState();
-}
-
-void InstancedSprite::EraseInstance(const size_t index)
-{
-    PACMAN_CHECK_ERROR((index < mInstancesCount) && mInstanceEraseEnabled);
-    std::vector<uint16_t>& indexData = mVertexBuffer->LockIndexData();
-
-    // calc removed size before current index
-    size_t removedSize = 0;
-    for (size_t i = 0; i < index; i++)
-    {
-        if (mInstancesEraseStates[i])
-            removedSize += kSpriteIndexCount;
-    }
-    // calc total offset
-    size_t instanceOffset = index * kSpriteIndexCount;
-    // reduce total offset by removed size
-    instanceOffset -= removedSize;
-    // fix index data
-    indexData.erase(indexData.begin() + instanceOffset, indexData.begin() + instanceOffset + kSpriteIndexCount);
-
-    mVertexBuffer->UnlockIndexData();
-    mInstancesEraseStates[index] = true;
-}
-
-std::shared_ptr<VertexBuffer> InstancedSprite::GetVertexBuffer() const
-{
-	return mVertexBuffer;
-}
-
-std::weak_ptr<Texture2D> InstancedSprite::GetTexture() const
-{
-	return mTexture;
-}
-
-std::shared_ptr<ShaderProgram> InstancedSprite::GetShaderProgram() const
-{
-	return mShaderProgram;
-}
-
-bool InstancedSprite::HasAlphaBlend() const
-{
-	return mAlphaBlend;
-}
-
-//TODO: remove copy paste!!!!!!!!!!!!!!!!!!!
-void InstancedSprite::InitByColor(const SpriteRegion& region, const Color leftTop, const Color rightTop, 
-					         	  const Color leftBottom, const Color rightBottom, const std::vector<Position>& instances)
-{
-    PACMAN_CHECK_ERROR(instances.size() > 0);
-
-    std::vector<ColorVertex> vertices;
-    std::vector<uint16_t> indices;
-
-    vertices.reserve(kSpriteVertexCount * instances.size());
-    indices.reserve(kSpriteIndexCount * instances.size());
-    FillVertexData(region, instances, vertices, indices);
-
-    PACMAN_CHECK_ERROR(vertices.size() / instances.size() == kSpriteVertexCount);
-    PACMAN_CHECK_ERROR(indices.size() / instances.size() == kSpriteIndexCount);
-
-    for (size_t i = 0; i < instances.size(); i++)
-    {
-        FillColor(vertices[i*kSpriteVertexCount + 0], leftTop);
-        FillColor(vertices[i*kSpriteVertexCount + 1], leftBottom);
-        FillColor(vertices[i*kSpriteVertexCount + 2], rightBottom);
-        FillColor(vertices[i*kSpriteVertexCount + 3], rightTop);
-    }
-
-    const BufferUsage indexBufferUsage = mInstanceEraseEnabled ? BufferUsage::Dynamic : BufferUsage::Static;
-	mVertexBuffer = std::make_shared<VertexBuffer>(vertices, indices, BufferUsage::Static, indexBufferUsage);
-}
-
-void InstancedSprite::InitByTexture(const SpriteRegion& region, const TextureRegion& textureRegion, const std::vector<Position>& instances)
-{
-    PACMAN_CHECK_ERROR(instances.size() > 0);
-
-    std::vector<TextureVertex> vertices;
-    std::vector<uint16_t> indices;
-
-    vertices.reserve(kSpriteVertexCount * instances.size());
-    indices.reserve(kSpriteIndexCount * instances.size());
-    FillVertexData(region, instances, vertices, indices);
-
-    PACMAN_CHECK_ERROR(vertices.size() / instances.size() == kSpriteVertexCount);
-    PACMAN_CHECK_ERROR(indices.size() / instances.size() == kSpriteIndexCount);
-
-	for (size_t i = 0; i < instances.size(); i++)
-    {
-        FillTexCoord(vertices[i*kSpriteVertexCount + 0], textureRegion.GetPosition());
-        FillTexCoord(vertices[i*kSpriteVertexCount + 1], Math::Vector2f(textureRegion.GetPosX(), textureRegion.GetPosY() + textureRegion.GetHeight()));
-        FillTexCoord(vertices[i*kSpriteVertexCount + 2], Math::Vector2f(textureRegion.GetPosX() + textureRegion.GetWidth(), textureRegion.GetPosY() + textureRegion.GetHeight()));
-        FillTexCoord(vertices[i*kSpriteVertexCount + 3], Math::Vector2f(textureRegion.GetPosX() + textureRegion.GetWidth(), textureRegion.GetPosY()));
-    }
-
-    const BufferUsage indexBufferUsage = mInstanceEraseEnabled ? BufferUsage::Dynamic : BufferUsage::Static;
-	mVertexBuffer = std::make_shared<VertexBuffer>(vertices, indices, BufferUsage::Static, indexBufferUsage);
-}
-
-void InstancedSprite::InitInstancesEraseState()
-{
-    if (!mInstanceEraseEnabled)
-    {
-        mInstancesEraseStates.reserve(0);
-        return;
-    }
-
-    mInstancesEraseStates = std::vector<bool>(mInstancesCount, false);
-}
-
-} // Pacman namespace
+#include "instanced_sprite.h"
+
+#include <limits>
+#include <cstring>
+
+#include "error.h"
+#include "texture.h"
+#include "vertex_buffer.h"
+#include "shader_program.h"
+
+namespace Pacman {
+
+static const size_t kSpriteVertexCount = 4;
+static const uint16_t kSpriteIndexCount = 6;
+static const std::array<uint16_t, kSpriteIndexCount> kBaseIndices = { 0, 1, 2, 0, 2, 3 };
+static const size_t kHiddenSlot = std::numeric_limits<size_t>::max();
+static const Color kDefaultColor = Color::kGreen;
+static const TextureRegion kDefaultRegion = TextureRegion(Math::Vector2f::kZero, 1.0f, 1.0f);
+
+template <typename VertexT>
+static FORCEINLINE void FillSpriteVertex(VertexT& vertex, const VertexT& baseVertex, const Position& position)
+{
+    vertex = baseVertex;
+    vertex.x += position.GetX();
+    vertex.y += position.GetY();
+}
+
+template <typename VertexT>
+static void FillVertexData(const SpriteRegion& region, const std::vector<Position>& positions,
+                           std::vector<VertexT>& vertices, std::vector<uint16_t>& indices)
+{
+    //                  base sprite
+    //                           	____
+    // 				 |\          	\ 	|  
+    // 	 	 	 |	 | \    ^    | 	 \ 	|  ^
+    // 	 	 	 v	 |  \   | +  v	  \	|  |
+    // 	 	 	 	 |___\        	   \|
+    //				   ->             ->
+
+    std::array<VertexT, kSpriteVertexCount> baseVertices;
+
+    // fiil base position data
+    baseVertices[0].x = region.GetPosX();
+    baseVertices[0].y = region.GetPosY();
+
+    baseVertices[1].x = region.GetLeftBottomPosX();
+    baseVertices[1].y = region.GetLeftBottomPosY();
+
+    baseVertices[2].x = region.GetRightBottomPosX();
+    baseVertices[2].y = region.GetRightBottomPosY();
+
+    baseVertices[3].x = region.GetRightTopPosX();
+    baseVertices[3].y = region.GetRightTopPosY();
+
+    // resize vectors to data size
+    vertices.resize(kSpriteVertexCount * positions.size());
+    indices.resize(kSpriteIndexCount * positions.size());
+
+    // fill position data
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        const Position& pos = positions[i];
+        for (size_t j = 0; j < kSpriteVertexCount; j++)
+        {
+            VertexT& vertex = vertices[i*kSpriteVertexCount + j];
+            FillSpriteVertex(vertex, baseVertices[j], pos);
+        }
+    }
+
+    // fill index data
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        for (size_t j = 0; j < kSpriteIndexCount; j++)
+        {
+            indices[i*kSpriteIndexCount + j] = kBaseIndices[j] + i*kSpriteVertexCount;
+        }
+    }
+}
+
+static FORCEINLINE void FillColor(ColorVertex& vertex, const Color color)
+{
+    vertex.r = color.GetRedFloat();
+    vertex.g = color.GetGreenFloat();
+    vertex.b = color.GetBlueFloat();
+    vertex.a = color.GetAlphaFloat();
+}
+
+static FORCEINLINE void FillTexCoord(TextureVertex& vertex, const Math::Vector2f& texCoord)
+{
+    vertex.u = texCoord.GetX();
+    vertex.v = texCoord.GetY();
+}
+
+//===========================================================================================================
+
+InstancedSprite::InstancedSprite(const SpriteRegion& region, const Color leftTop, const Color rightTop, const Color leftBottom,
+			                     const Color rightBottom, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend,
+                                 const std::vector<Position>& instances, const bool instanceEraseEnabled)
+	           : mShaderProgram(std::move(shaderProgram)),
+	             mTexture(nullptr),
+		         mVertexBuffer(nullptr),
+		         mAlphaBlend(alphaBlend),
+                 mInstanceEraseEnabled(instanceEraseEnabled),
+                 mInstancesCount(instances.size()),
+                 mVisibleInstancesCount(instances.size()),
+                 mBasePosition(instances.empty() ? Position::kZero : instances.front())
+{
+	InitByColor(region, leftTop, rightTop, leftBottom, rightBottom, instances);
+    InitInstancesEraseState();
+}
+
+InstancedSprite::InstancedSprite(const SpriteRegion& region, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend,
+                                 const std::vector<Position>& instances, const bool instanceEraseEnabled)
+	           : mShaderProgram(std::move(shaderProgram)),
+	             mTexture(nullptr),
+		         mVertexBuffer(nullptr),
+		         mAlphaBlend(alphaBlend),
+                 mInstanceEraseEnabled(instanceEraseEnabled),
+                 mInstancesCount(instances.size()),
+                 mVisibleInstancesCount(instances.size()),
+                 mBasePosition(instances.empty() ? Position::kZero : instances.front())
+{
+	InitByColor(region, kDefaultColor, kDefaultColor, kDefaultColor, kDefaultColor, instances);
+    InitInstancesEraseState();
+}
+
+InstancedSprite::InstancedSprite(const SpriteRegion& region, const TextureRegion& textureRegion, const std::shared_ptr<Texture2D> texture,
+			                     const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend, const std::vector<Position>& instances,
+                                 const bool instanceEraseEnabled)
+	           : mShaderProgram(std::move(shaderProgram)),
+	             mTexture(std::move(texture)),
+		         mVertexBuffer(nullptr),
+		         mAlphaBlend(alphaBlend),
+                 mInstanceEraseEnabled(instanceEraseEnabled),
+                 mInstancesCount(instances.size()),
+                 mVisibleInstancesCount(instances.size()),
+                 mBasePosition(instances.empty() ? Position::kZero : instances.front())
+{
+	InitByTexture(region, textureRegion, instances);
+    InitInstancesEraseState();
+}
+
+InstancedSprite::InstancedSprite(const SpriteRegion& region, const std::shared_ptr<Texture2D> texture, const std::shared_ptr<ShaderProgram> shaderProgram,
+                                 const bool alphaBlend, const std::vector<Position>& instances, const bool instanceEraseEnabled)
+	           : mShaderProgram(std::move(shaderProgram)),
+	             mTexture(std::move(texture)),
+		         mVertexBuffer(nullptr),
+		         mAlphaBlend(alphaBlend),
+                 mInstanceEraseEnabled(instanceEraseEnabled),
+                 mInstancesCount(instances.size()),
+                 mVisibleInstancesCount(instances.size()),
+                 mBasePosition(instances.empty() ? Position::kZero : instances.front())
+{
+	InitByTexture(region, kDefaultRegion, instances);
+    InitInstancesEraseState();
+}
+
+void InstancedSprite::EraseInstance(const size_t index)
+{
+    PACMAN_CHECK_ERROR((index < mInstancesCount) && mInstanceEraseEnabled);
+    const size_t slot = mInstanceSlots[index];
+    if (slot == kHiddenSlot)
+        return;
+
+    std::vector<uint16_t>& indexData = mVertexBuffer->LockIndexData();
+
+    // move the last visible instance into the freed slot
+    const size_t lastSlot = mVisibleInstancesCount - 1;
+    const size_t lastInstance = mSlotInstances[lastSlot];
+    if (slot != lastSlot)
+        FillSlot(indexData, slot, lastInstance);
+
+    mInstanceSlots[index] = kHiddenSlot;
+    mVisibleInstancesCount--;
+    // the capacity is kept, so the next ShowInstance doesn't allocate
+    indexData.resize(mVisibleInstancesCount * kSpriteIndexCount);
+
+    const size_t dirtyCount = (slot != lastSlot) ? kSpriteIndexCount : 0;
+    mVertexBuffer->UnlockIndexData(slot * kSpriteIndexCount, dirtyCount);
+}
+
+void InstancedSprite::ShowInstance(const size_t index)
+{
+    PACMAN_CHECK_ERROR((index < mInstancesCount) && mInstanceEraseEnabled);
+    if (mInstanceSlots[index] != kHiddenSlot)
+        return;
+
+    std::vector<uint16_t>& indexData = mVertexBuffer->LockIndexData();
+
+    const size_t slot = mVisibleInstancesCount;
+    mVisibleInstancesCount++;
+    indexData.resize(mVisibleInstancesCount * kSpriteIndexCount);
+    FillSlot(indexData, slot, index);
+
+    mVertexBuffer->UnlockIndexData(slot * kSpriteIndexCount, kSpriteIndexCount);
+}
+
+void InstancedSprite::ShowAllInstances()
+{
+    PACMAN_CHECK_ERROR(mInstanceEraseEnabled);
+    if (mVisibleInstancesCount == mInstancesCount)
+        return;
+
+    std::vector<uint16_t>& indexData = mVertexBuffer->LockIndexData();
+
+    mVisibleInstancesCount = mInstancesCount;
+    indexData.resize(mInstancesCount * kSpriteIndexCount);
+    for (size_t i = 0; i < mInstancesCount; i++)
+    {
+        FillSlot(indexData, i, i);
+    }
+
+    mVertexBuffer->UnlockIndexData();
+}
+
+size_t InstancedSprite::AddInstance(const Position& position)
+{
+    PACMAN_CHECK_ERROR(mInstanceEraseEnabled);
+    PACMAN_CHECK_ERROR2((mInstancesCount + 1) * kSpriteVertexCount <= std::numeric_limits<uint16_t>::max(), "too many instances");
+
+    // copy the vertices of the first instance and move them to the new position
+    // (position is the first member of all the vertex types)
+    std::vector<byte_t>& vertexData = mVertexBuffer->LockVertexData();
+    const size_t stride = mVertexBuffer->GetVertexAttribute(0).mStride;
+    const size_t instanceSize = stride * kSpriteVertexCount;
+    const size_t instanceOffset = vertexData.size();
+
+    vertexData.resize(instanceOffset + instanceSize);
+    std::memcpy(&vertexData[instanceOffset], &vertexData.front(), instanceSize);
+    for (size_t i = 0; i < kSpriteVertexCount; i++)
+    {
+        uint16_t* vertexPosition = reinterpret_cast<uint16_t*>(&vertexData[instanceOffset + i*stride]);
+        vertexPosition[0] = static_cast<uint16_t>(vertexPosition[0] - mBasePosition.GetX() + position.GetX());
+        vertexPosition[1] = static_cast<uint16_t>(vertexPosition[1] - mBasePosition.GetY() + position.GetY());
+    }
+
+    mVertexBuffer->UnlockVertexData(mVertexBuffer->GetVertexCount() + kSpriteVertexCount, instanceOffset, instanceSize);
+
+    const size_t index = mInstancesCount;
+    mInstancesCount++;
+    mInstanceSlots.push_back(kHiddenSlot);
+    mSlotInstances.push_back(kHiddenSlot);
+    ShowInstance(index);
+    return index;
+}
+
+bool InstancedSprite::IsInstanceVisible(const size_t index) const
+{
+    PACMAN_CHECK_ERROR(index < mInstancesCount);
+    return !mInstanceEraseEnabled || (mInstanceSlots[index] != kHiddenSlot);
+}
+
+std::shared_ptr<VertexBuffer> InstancedSprite::GetVertexBuffer() const
+{
+	return mVertexBuffer;
+}
+
+std::weak_ptr<Texture2D> InstancedSprite::GetTexture() const
+{
+	return mTexture;
+}
+
+std::shared_ptr<ShaderProgram> InstancedSprite::GetShaderProgram() const
+{
+	return mShaderProgram;
+}
+
+bool InstancedSprite::HasAlphaBlend() const
+{
+	return mAlphaBlend;
+}
+
+const SpriteQuad* InstancedSprite::GetSpriteQuad() const
+{
+	return nullptr;
+}
+
+//TODO: remove copy paste!!!!!!!!!!!!!!!!!!!
+void InstancedSprite::InitByColor(const SpriteRegion& region, const Color leftTop, const Color rightTop, 
+					         	  const Color leftBottom, const Color rightBottom, const std::vector<Position>& instances)
+{
+    PACMAN_CHECK_ERROR(instances.size() > 0);
+
+    std::vector<ColorVertex> vertices;
+    std::vector<uint16_t> indices;
+
+    vertices.reserve(kSpriteVertexCount * instances.size());
+    indices.reserve(kSpriteIndexCount * instances.size());
+    FillVertexData(region, instances, vertices, indices);
+
+    PACMAN_CHECK_ERROR(vertices.size() / instances.size() == kSpriteVertexCount);
+    PACMAN_CHECK_ERROR(indices.size() / instances.size() == kSpriteIndexCount);
+
+    for (size_t i = 0; i < instances.size(); i++)
+    {
+        FillColor(vertices[i*kSpriteVertexCount + 0], leftTop);
+        FillColor(vertices[i*kSpriteVertexCount + 1], leftBottom);
+        FillColor(vertices[i*kSpriteVertexCount + 2], rightBottom);
+        FillColor(vertices[i*kSpriteVertexCount + 3], rightTop);
+    }
+
+    const BufferUsage usage = mInstanceEraseEnabled ? BufferUsage::Dynamic : BufferUsage::Static;
+	mVertexBuffer = std::make_shared<VertexBuffer>(vertices, indices, usage, usage);
+}
+
+void InstancedSprite::InitByTexture(const SpriteRegion& region, const TextureRegion& textureRegion, const std::vector<Position>& instances)
+{
+    PACMAN_CHECK_ERROR(instances.size() > 0);
+
+    std::vector<TextureVertex> vertices;
+    std::vector<uint16_t> indices;
+
+    vertices.reserve(kSpriteVertexCount * instances.size());
+    indices.reserve(kSpriteIndexCount * instances.size());
+    FillVertexData(region, instances, vertices, indices);
+
+    PACMAN_CHECK_ERROR(vertices.size() / instances.size() == kSpriteVertexCount);
+    PACMAN_CHECK_ERROR(indices.size() / instances.size() == kSpriteIndexCount);
+
+	for (size_t i = 0; i < instances.size(); i++)
+    {
+        FillTexCoord(vertices[i*kSpriteVertexCount + 0], textureRegion.GetPosition());
+        FillTexCoord(vertices[i*kSpriteVertexCount + 1], Math::Vector2f(textureRegion.GetPosX(), textureRegion.GetPosY() + textureRegion.GetHeight()));
+        FillTexCoord(vertices[i*kSpriteVertexCount + 2], Math::Vector2f(textureRegion.GetPosX() + textureRegion.GetWidth(), textureRegion.GetPosY() + textureRegion.GetHeight()));
+        FillTexCoord(vertices[i*kSpriteVertexCount + 3], Math::Vector2f(textureRegion.GetPosX() + textureRegion.GetWidth(), textureRegion.GetPosY()));
+    }
+
+    const BufferUsage usage = mInstanceEraseEnabled ? BufferUsage::Dynamic : BufferUsage::Static;
+	mVertexBuffer = std::make_shared<VertexBuffer>(vertices, indices, usage, usage);
+}
+
+void InstancedSprite::InitInstancesEraseState()
+{
+    if (!mInstanceEraseEnabled)
+        return;
+
+    mInstanceSlots.resize(mInstancesCount);
+    mSlotInstances.resize(mInstancesCount);
+    for (size_t i = 0; i < mInstancesCount; i++)
+    {
+        mInstanceSlots[i] = i;
+        mSlotInstances[i] = i;
+    }
+}
+
+void InstancedSprite::FillSlot(std::vector<uint16_t>& indexData, const size_t slot, const size_t instance)
+{
+    for (size_t j = 0; j < kSpriteIndexCount; j++)
+    {
+        indexData[slot*kSpriteIndexCount + j] = static_cast<uint16_t>(kBaseIndices[j] + instance*kSpriteVertexCount);
+    }
+
+    mInstanceSlots[instance] = slot;
+    mSlotInstances[slot] = instance;
+}
+
+} // Pacman namespace
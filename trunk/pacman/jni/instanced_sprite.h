@@ -1,68 +1,100 @@
-#pragma once
-
-#include <array>
-#include <memory>
-#include <vector>
-
-#include "base.h"
-#include "engine_forwdecl.h"
-#include "engine_typedefs.h"
-#include "drawable.h"
-#include "color.h"
-
-namespace Pacman {
-
-class InstancedSprite : public IDrawable
-{
-public:
-
-	InstancedSprite() = delete;
-
-	InstancedSprite(const SpriteRegion& region, const Color leftTop, const Color rightTop, const Color leftBottom,
-		            const Color rightBottom, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend,
-                    const std::vector<Position>& instances, const bool instanceEraseEnabled);
-
-	InstancedSprite(const SpriteRegion& region, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend,
-                    const std::vector<Position>& instances, const bool instanceEraseEnabled);
-
-	InstancedSprite(const SpriteRegion& region, const TextureRegion& textureRegion, const std::shared_ptr<Texture2D> texture,
-		            const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend, const std::vector<Position>& instances,
-                    const bool instanceEraseEnabled);
-
-	InstancedSprite(const SpriteRegion& region, const std::shared_ptr<Texture2D> texture, const std::shared_ptr<ShaderProgram> shaderProgram,
-                    const bool alphaBlend, const std::vector<Position>& instances, const bool instanceEraseEnabled);
-
-	InstancedSprite(const InstancedSprite&) = default;
-	~InstancedSprite() = default;
-
-	InstancedSprite& operator= (const InstancedSprite&) = default;
-
-    void EraseInstance(const size_t index);
-
-	virtual std::shared_ptr<VertexBuffer> GetVertexBuffer() const;
-
-	virtual std::weak_ptr<Texture2D> GetTexture() const;
-
-	virtual std::shared_ptr<ShaderProgram> GetShaderProgram() const;
-
-	virtual bool HasAlphaBlend() const;
-
-private:
-
-	void InitByColor(const SpriteRegion& region, const Color leftTop, const Color rightTop,
-			   	   	 const Color leftBottom, const Color rightBottom, const std::vector<Position>& instances);
-
-	void InitByTexture(const SpriteRegion& region, const TextureRegion& textureRegion, const std::vector<Position>& instances);
-
-    void InitInstancesEraseState();
-
-	std::shared_ptr<VertexBuffer>  mVertexBuffer;
-	std::shared_ptr<Texture2D>     mTexture;
-	std::shared_ptr<ShaderProgram> mShaderProgram;
-    std::vector<bool>              mInstancesEraseStates; // true - erased, false - present
-	bool                           mAlphaBlend;
-    bool                           mInstanceEraseEnabled;
-    size_t                         mInstancesCount;
-};
-
-} // Pacman namespace
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "base.h"
+#include "engine_forwdecl.h"
+#include "engine_typedefs.h"
+#include "drawable.h"
+#include "color.h"
+
+namespace Pacman {
+
+class InstancedSprite : public IDrawable
+{
+public:
+
+	InstancedSprite() = delete;
+
+	InstancedSprite(const SpriteRegion& region, const Color leftTop, const Color rightTop, const Color leftBottom,
+		            const Color rightBottom, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend,
+                    const std::vector<Position>& instances, const bool instanceEraseEnabled);
+
+	InstancedSprite(const SpriteRegion& region, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend,
+                    const std::vector<Position>& instances, const bool instanceEraseEnabled);
+
+	InstancedSprite(const SpriteRegion& region, const TextureRegion& textureRegion, const std::shared_ptr<Texture2D> texture,
+		            const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend, const std::vector<Position>& instances,
+                    const bool instanceEraseEnabled);
+
+	InstancedSprite(const SpriteRegion& region, const std::shared_ptr<Texture2D> texture, const std::shared_ptr<ShaderProgram> shaderProgram,
+                    const bool alphaBlend, const std::vector<Position>& instances, const bool instanceEraseEnabled);
+
+	InstancedSprite(const InstancedSprite&) = default;
+	~InstancedSprite() = default;
+
+	InstancedSprite& operator= (const InstancedSprite&) = default;
+
+    // instances are changed in O(1), visible instances are kept packed in the index data
+    // (the erased one is replaced by the last visible instance)
+    // the sprite must be created with the instanceEraseEnabled flag
+
+    // index - instance index in the creation order
+    void EraseInstance(const size_t index);
+
+    void ShowInstance(const size_t index);
+
+    void ShowAllInstances();
+
+    // returns the new instance index
+    size_t AddInstance(const Position& position);
+
+    bool IsInstanceVisible(const size_t index) const;
+
+    size_t GetInstancesCount() const
+    {
+        return mInstancesCount;
+    }
+
+    size_t GetVisibleInstancesCount() const
+    {
+        return mVisibleInstancesCount;
+    }
+
+	virtual std::shared_ptr<VertexBuffer> GetVertexBuffer() const;
+
+	virtual std::weak_ptr<Texture2D> GetTexture() const;
+
+	virtual std::shared_ptr<ShaderProgram> GetShaderProgram() const;
+
+	virtual bool HasAlphaBlend() const;
+
+	virtual const SpriteQuad* GetSpriteQuad() const;
+
+private:
+
+	void InitByColor(const SpriteRegion& region, const Color leftTop, const Color rightTop,
+			   	   	 const Color leftBottom, const Color rightBottom, const std::vector<Position>& instances);
+
+	void InitByTexture(const SpriteRegion& region, const TextureRegion& textureRegion, const std::vector<Position>& instances);
+
+    void InitInstancesEraseState();
+
+    // write the instance indices into the index data slot
+    void FillSlot(std::vector<uint16_t>& indexData, const size_t slot, const size_t instance);
+
+	std::shared_ptr<VertexBuffer>  mVertexBuffer;
+	std::shared_ptr<Texture2D>     mTexture;
+	std::shared_ptr<ShaderProgram> mShaderProgram;
+    std::vector<size_t>            mInstanceSlots; // instance -> index data slot (kHiddenSlot if erased)
+    std::vector<size_t>            mSlotInstances; // index data slot -> instance
+	bool                           mAlphaBlend;
+    bool                           mInstanceEraseEnabled;
+    size_t                         mInstancesCount;
+    size_t                         mVisibleInstancesCount;
+    Position                       mBasePosition; // of the first instance
+};
+
+} // Pacman namespace
@@ -1,24 +1,45 @@
-#pragma once
-
-#include <android/log.h>
-#include <utility>
-
-#include "base.h"
-
-namespace Pacman {
-
-static const char* kTag = "NativeLib";
-
-template <typename... Args>
-static FORCEINLINE void LogI(Args&&... args)
-{
-    __android_log_print(ANDROID_LOG_INFO,  kTag, std::forward<Args>(args)...);
-}
-
-template <typename... Args>
-static FORCEINLINE void LogE(Args&&... args)
-{
-    __android_log_print(ANDROID_LOG_ERROR,  kTag, std::forward<Args>(args)...);
-}
-
+#pragma once
+
+#ifdef PACMAN_HEADLESS
+#include <cstdio>
+#else
+#include <android/log.h>
+#endif
+#include <utility>
+
+#include "base.h"
+
+namespace Pacman {
+
+static const char* kTag = "NativeLib";
+
+#ifdef PACMAN_HEADLESS
+// the headless build has no logcat, the messages are printed to the console
+template <typename... Args>
+static FORCEINLINE void LogI(Args&&... args)
+{
+    std::printf(std::forward<Args>(args)...);
+    std::printf("\n");
+}
+
+template <typename... Args>
+static FORCEINLINE void LogE(Args&&... args)
+{
+    std::fprintf(stderr, std::forward<Args>(args)...);
+    std::fprintf(stderr, "\n");
+}
+#else
+template <typename... Args>
+static FORCEINLINE void LogI(Args&&... args)
+{
+    __android_log_print(ANDROID_LOG_INFO,  kTag, std::forward<Args>(args)...);
+}
+
+template <typename... Args>
+static FORCEINLINE void LogE(Args&&... args)
+{
+    __android_log_print(ANDROID_LOG_ERROR,  kTag, std::forward<Args>(args)...);
+}
+#endif
+
 } // Pacman namespace
\ No newline at end of file
@@ -1,6 +1,6 @@
-#pragma once
-
-#include "base.h"
-#include "engine_forwdecl.h"
-
+#pragma once
+
+#include "base.h"
+#include "engine_forwdecl.h"
+
 void PacmanSetEngineListener(Pacman::Engine& engine);
\ No newline at end of file
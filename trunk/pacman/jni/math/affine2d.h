@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+
+#include "base.h"
+#include "math.h"
+#include "vector2.h"
+#include "vector3.h"
+#include "matrix4.h"
+
+namespace Pacman {
+namespace Math {
+
+// 2D affine transform, the 3x3 matrix without the last (0, 0, 1) row:
+// x' = m00 * x + m01 * y + m02
+// y' = m10 * x + m11 * y + m12
+template <typename T>
+class Affine2D
+{
+public:
+
+	PACMAN_CHECK_ARITHMETIC_TYPE;
+
+	static const Affine2D<T> kIdentity;
+
+    typedef T value_t;
+
+	// the 2D part of the Matrix4::Ortho (the z is always 0)
+	static Affine2D<T> Ortho(const T left, const T right, const T bottom, const T top);
+
+	static Affine2D<T> MakeTranslation(const T x, const T y);
+	// angle must be in the radians
+	static Affine2D<T> MakeRotation(const T angle);
+	// rotation about the pivot point
+	static Affine2D<T> MakeRotation(const T angle, const T pivotX, const T pivotY);
+	static Affine2D<T> MakeScale(const T x, const T y);
+
+	explicit Affine2D() = default;
+	explicit Affine2D(const T m00, const T m01, const T m02,
+					  const T m10, const T m11, const T m12);
+
+	Affine2D(const Affine2D<T>& other);
+	~Affine2D() = default;
+
+	Affine2D<T>& operator= (const Affine2D<T>& other);
+
+	bool operator== (const Affine2D<T>& other) const;
+	bool operator!= (const Affine2D<T>& other) const;
+
+	// composition, the other transform is applied first
+	Affine2D<T> operator* (const Affine2D<T>& other) const;
+	Affine2D<T>& operator*= (const Affine2D<T>& other);
+
+	T* operator[] (const size_t rowIndex);
+	const T* operator[] (const size_t rowIndex) const;
+
+	// rows are stored one by one (6 values)
+	T* GetRawData();
+	const T* GetRawData() const;
+
+	Vector3<T> GetRow(const size_t rowIndex) const;
+
+	Vector2<T> TransformPoint(const Vector2<T>& point) const;
+	Vector2<T> TransformPoint(const T x, const T y) const;
+
+	// returns the identity if the transform is degenerate
+	Affine2D<T> Inverse() const;
+
+	// translation applied after the transform
+	Affine2D<T>& Translate(const T x, const T y);
+
+	// the same transform as the 4x4 row-major matrix
+	Matrix4<T> ToMatrix4() const;
+
+private:
+
+	union
+	{
+		struct
+		{
+			T mM00, mM01, mM02,
+			  mM10, mM11, mM12;
+		};
+		std::array<T, 6> mData;
+		std::array<std::array<T, 3>, 2> mRowData;
+	};
+};
+
+template <typename T>
+const Affine2D<T> Affine2D<T>::kIdentity = Affine2D<T>(T(1), T(0), T(0),
+                                                       T(0), T(1), T(0));
+
+typedef Affine2D<float>  Affine2Df;
+typedef Affine2D<double> Affine2Dd;
+
+} // Math namespace
+} // Pacman namespace
+
+#include "affine2d.inl"
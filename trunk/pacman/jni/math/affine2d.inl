@@ -0,0 +1,191 @@
+#include <cmath>
+
+namespace Pacman {
+namespace Math {
+
+template <typename T>
+Affine2D<T> Affine2D<T>::Ortho(const T left, const T right, const T bottom, const T top)
+{
+	const T val1 = T(2) / (right - left);
+	const T val2 = T(2) / (top - bottom);
+
+	const T tx = -(right + left) / (right - left);
+	const T ty = -(top + bottom) / (top - bottom);
+
+	return Affine2D<T>(val1, T(0), tx,
+					   T(0), val2, ty);
+}
+
+template <typename T>
+inline FORCEINLINE Affine2D<T> Affine2D<T>::MakeTranslation(const T x, const T y)
+{
+	return Affine2D<T>(T(1), T(0), x,
+					   T(0), T(1), y);
+}
+
+template <typename T>
+inline FORCEINLINE Affine2D<T> Affine2D<T>::MakeRotation(const T angle)
+{
+	// the same direction as the Matrix4::RotateZ has
+	const T angleSin = std::sin(angle);
+	const T angleCos = std::cos(angle);
+
+	return Affine2D<T>(angleCos,  angleSin, T(0),
+					   -angleSin, angleCos, T(0));
+}
+
+template <typename T>
+inline FORCEINLINE Affine2D<T> Affine2D<T>::MakeRotation(const T angle, const T pivotX, const T pivotY)
+{
+	// translate(pivot) * rotate * translate(-pivot)
+	const T angleSin = std::sin(angle);
+	const T angleCos = std::cos(angle);
+
+	return Affine2D<T>(angleCos,  angleSin, pivotX - angleCos * pivotX - angleSin * pivotY,
+					   -angleSin, angleCos, pivotY + angleSin * pivotX - angleCos * pivotY);
+}
+
+template <typename T>
+inline FORCEINLINE Affine2D<T> Affine2D<T>::MakeScale(const T x, const T y)
+{
+	return Affine2D<T>(x,    T(0), T(0),
+					   T(0), y,    T(0));
+}
+
+template <typename T>
+inline FORCEINLINE Affine2D<T>::Affine2D(const T m00, const T m01, const T m02,
+								  const T m10, const T m11, const T m12)
+					   : mM00(m00), mM01(m01), mM02(m02),
+						 mM10(m10), mM11(m11), mM12(m12)
+{
+}
+
+template <typename T>
+inline FORCEINLINE Affine2D<T>::Affine2D(const Affine2D<T>& other)
+					   : mData(other.mData)
+{
+}
+
+template <typename T>
+inline FORCEINLINE Affine2D<T>& Affine2D<T>::operator= (const Affine2D<T>& other)
+{
+	if (this != &other)
+	{
+		mData = other.mData;
+	}
+
+	return *this;
+}
+
+template <typename T>
+inline FORCEINLINE bool Affine2D<T>::operator== (const Affine2D<T>& other) const
+{
+	return (Comparator<T>::Equals(mM00, other.mM00) && Comparator<T>::Equals(mM01, other.mM01) &&
+			Comparator<T>::Equals(mM02, other.mM02) &&
+
+			Comparator<T>::Equals(mM10, other.mM10) && Comparator<T>::Equals(mM11, other.mM11) &&
+			Comparator<T>::Equals(mM12, other.mM12));
+}
+
+template <typename T>
+inline FORCEINLINE bool Affine2D<T>::operator!= (const Affine2D<T>& other) const
+{
+	return !(*this == other);
+}
+
+template <typename T>
+inline FORCEINLINE Affine2D<T> Affine2D<T>::operator* (const Affine2D<T>& other) const
+{
+	return Affine2D<T>(mM00 * other.mM00 + mM01 * other.mM10,
+					   mM00 * other.mM01 + mM01 * other.mM11,
+					   mM00 * other.mM02 + mM01 * other.mM12 + mM02,
+
+					   mM10 * other.mM00 + mM11 * other.mM10,
+					   mM10 * other.mM01 + mM11 * other.mM11,
+					   mM10 * other.mM02 + mM11 * other.mM12 + mM12);
+}
+
+template <typename T>
+inline FORCEINLINE Affine2D<T>& Affine2D<T>::operator*= (const Affine2D<T>& other)
+{
+	return *this = (*this * other);
+}
+
+template <typename T>
+inline FORCEINLINE T* Affine2D<T>::operator[] (const size_t rowIndex)
+{
+	return mRowData[rowIndex].data();
+}
+
+template <typename T>
+inline FORCEINLINE const T* Affine2D<T>::operator[] (const size_t rowIndex) const
+{
+	return mRowData[rowIndex].data();
+}
+
+template <typename T>
+inline FORCEINLINE T* Affine2D<T>::GetRawData()
+{
+	return mData.data();
+}
+
+template <typename T>
+inline FORCEINLINE const T* Affine2D<T>::GetRawData() const
+{
+	return mData.data();
+}
+
+template <typename T>
+inline FORCEINLINE Vector3<T> Affine2D<T>::GetRow(const size_t rowIndex) const
+{
+	return Vector3<T>(mRowData[rowIndex].data());
+}
+
+template <typename T>
+inline FORCEINLINE Vector2<T> Affine2D<T>::TransformPoint(const Vector2<T>& point) const
+{
+	return TransformPoint(point.GetX(), point.GetY());
+}
+
+template <typename T>
+inline FORCEINLINE Vector2<T> Affine2D<T>::TransformPoint(const T x, const T y) const
+{
+	return Vector2<T>(mM00 * x + mM01 * y + mM02,
+					  mM10 * x + mM11 * y + mM12);
+}
+
+template <typename T>
+Affine2D<T> Affine2D<T>::Inverse() const
+{
+	T det = mM00 * mM11 - mM01 * mM10;
+	if (std::abs(det) < (std::numeric_limits<T>::epsilon())) return kIdentity;
+	det = T(1) / det;
+
+	const T i00 = mM11 * det;
+	const T i01 = -mM01 * det;
+	const T i10 = -mM10 * det;
+	const T i11 = mM00 * det;
+
+	return Affine2D<T>(i00, i01, -(i00 * mM02 + i01 * mM12),
+					   i10, i11, -(i10 * mM02 + i11 * mM12));
+}
+
+template <typename T>
+inline FORCEINLINE Affine2D<T>& Affine2D<T>::Translate(const T x, const T y)
+{
+	mM02 += x;
+	mM12 += y;
+	return *this;
+}
+
+template <typename T>
+inline FORCEINLINE Matrix4<T> Affine2D<T>::ToMatrix4() const
+{
+	return Matrix4<T>(mM00, mM01, T(0), mM02,
+					  mM10, mM11, T(0), mM12,
+					  T(0), T(0), T(1), T(0),
+					  T(0), T(0), T(0), T(1));
+}
+
+} // Math namespace
+} // Pacman namespace
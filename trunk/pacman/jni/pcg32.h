@@ -0,0 +1,68 @@
+#pragma once
+
+#include "base.h"
+
+namespace Pacman {
+
+// PCG32 (XSH RR) random generator: 64-bit state, 32-bit output
+// the generators with the same seed and the different streams give the independent sequences,
+// the sequence is the same on every platform, it never allocates
+class Pcg32
+{
+public:
+
+    Pcg32()
+    {
+        Seed(0, 0);
+    }
+
+    Pcg32(const uint64_t seed, const uint64_t stream)
+    {
+        Seed(seed, stream);
+    }
+
+    Pcg32(const Pcg32&) = default;
+    ~Pcg32() = default;
+
+    Pcg32& operator= (const Pcg32&) = default;
+
+    void Seed(const uint64_t seed, const uint64_t stream)
+    {
+        mState = 0;
+        mIncrement = (stream << 1) | 1; // should be odd
+        Next();
+        mState += seed;
+        Next();
+    }
+
+    uint32_t Next()
+    {
+        const uint64_t oldState = mState;
+        mState = (oldState * kMultiplier) + mIncrement;
+
+        const uint32_t xorShifted = static_cast<uint32_t>(((oldState >> 18) ^ oldState) >> 27);
+        const uint32_t rotation = static_cast<uint32_t>(oldState >> 59);
+        return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+    }
+
+    // uniform value in [0, bound), the values of the biased range are skipped
+    uint32_t Next(const uint32_t bound)
+    {
+        const uint32_t threshold = (0u - bound) % bound;
+        for (;;)
+        {
+            const uint32_t value = Next();
+            if (value >= threshold)
+                return value % bound;
+        }
+    }
+
+private:
+
+    static const uint64_t kMultiplier = 6364136223846793005ULL;
+
+    uint64_t mState;
+    uint64_t mIncrement;
+};
+
+} // Pacman namespace
@@ -0,0 +1,167 @@
+#include "profiler.h"
+
+#include <pthread.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <vector>
+
+#include "log.h"
+#include "timer.h"
+
+namespace Pacman {
+
+static const double kNanosecPerMicrosec = 1000.0;
+
+// written by the owner thread only
+struct ThreadEvents
+{
+    ThreadEvents(const size_t threadId)
+        : mThreadId(threadId),
+          mName(nullptr),
+          mEvents(Profiler::kThreadEventsCapacity),
+          mCount(0)
+    {
+    }
+
+    const size_t              mThreadId;
+    std::atomic<const char*>  mName;
+    std::vector<ProfileEvent> mEvents;
+    std::atomic<uint64_t>     mCount; // of all the pushed events
+};
+
+static pthread_once_t gThreadEventsKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t gThreadEventsKey;
+static pthread_mutex_t gThreadsMutex = PTHREAD_MUTEX_INITIALIZER;
+static std::vector<ThreadEvents*> gThreadsEvents; // the events of the finished threads are kept too
+
+static void CreateThreadEventsKey()
+{
+    pthread_key_create(&gThreadEventsKey, nullptr);
+}
+
+static ThreadEvents& GetThreadEvents()
+{
+    pthread_once(&gThreadEventsKeyOnce, &CreateThreadEventsKey);
+
+    ThreadEvents* threadEvents = static_cast<ThreadEvents*>(pthread_getspecific(gThreadEventsKey));
+    if (threadEvents == nullptr)
+    {
+        pthread_mutex_lock(&gThreadsMutex);
+        threadEvents = new ThreadEvents(gThreadsEvents.size() + 1);
+        gThreadsEvents.push_back(threadEvents);
+        pthread_mutex_unlock(&gThreadsMutex);
+
+        pthread_setspecific(gThreadEventsKey, threadEvents);
+    }
+
+    return *threadEvents;
+}
+
+static void AppendThreadTrace(const ThreadEvents& threadEvents, std::string& trace)
+{
+    char buffer[256];
+
+    const char* threadName = threadEvents.mName.load();
+    if (threadName != nullptr)
+    {
+        snprintf(buffer, sizeof(buffer), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}},",
+                 static_cast<unsigned>(threadEvents.mThreadId), threadName);
+        trace += buffer;
+    }
+
+    const uint64_t kCapacity = Profiler::kThreadEventsCapacity;
+    const uint64_t count = threadEvents.mCount.load(std::memory_order_acquire);
+    const uint64_t first = (count > kCapacity) ? (count - kCapacity) : 0;
+    std::vector<ProfileEvent> events;
+    events.reserve(count - first);
+    for (uint64_t i = first; i < count; i++)
+    {
+        events.push_back(threadEvents.mEvents[i % kCapacity]);
+    }
+
+    // the overwritten ones (and the one which is being written) are dropped
+    const uint64_t newCount = threadEvents.mCount.load(std::memory_order_acquire);
+    const uint64_t validFirst = (newCount + 1 > kCapacity) ? (newCount + 1 - kCapacity) : 0;
+    const size_t skipCount = (validFirst > first) ? static_cast<size_t>(std::min(validFirst - first, count - first)) : 0;
+
+    // the ends of the overwritten begins are dropped
+    size_t depth = 0;
+    for (size_t i = skipCount; i < events.size(); i++)
+    {
+        const ProfileEvent& event = events[i];
+        if (event.mType == ProfileEventType::End)
+        {
+            if (depth == 0)
+                continue;
+
+            depth--;
+        }
+        else
+        {
+            depth++;
+        }
+
+        snprintf(buffer, sizeof(buffer), "{\"name\":\"%s\",\"ph\":\"%s\",\"pid\":1,\"tid\":%u,\"ts\":%.3f},",
+                 event.mName, (event.mType == ProfileEventType::Begin) ? "B" : "E",
+                 static_cast<unsigned>(threadEvents.mThreadId), static_cast<double>(event.mTime) / kNanosecPerMicrosec);
+        trace += buffer;
+    }
+}
+
+void Profiler::PushEvent(const char* name, const ProfileEventType type)
+{
+    ThreadEvents& threadEvents = GetThreadEvents();
+    const uint64_t count = threadEvents.mCount.load(std::memory_order_relaxed);
+
+    ProfileEvent& event = threadEvents.mEvents[count % kThreadEventsCapacity];
+    event.mName = name;
+    event.mTime = Timer::GetCurrentTime();
+    event.mType = type;
+    threadEvents.mCount.store(count + 1, std::memory_order_release);
+}
+
+void Profiler::SetThreadName(const char* name)
+{
+    GetThreadEvents().mName = name;
+}
+
+std::string Profiler::MakeChromeTrace()
+{
+    std::string trace = "{\"traceEvents\":[";
+
+    pthread_mutex_lock(&gThreadsMutex);
+    for (const ThreadEvents* threadEvents : gThreadsEvents)
+    {
+        AppendThreadTrace(*threadEvents, trace);
+    }
+    pthread_mutex_unlock(&gThreadsMutex);
+
+    if (trace[trace.size() - 1] == ',')
+        trace.erase(trace.size() - 1);
+
+    trace += "],\"displayTimeUnit\":\"ms\"}";
+    return trace;
+}
+
+void Profiler::SaveChromeTrace(const std::string& fileName)
+{
+    const std::string trace = MakeChromeTrace();
+
+    // the trace is a diagnostic, its failure doesn't terminate the game
+    FILE* file = fopen(fileName.c_str(), "wb");
+    if (file == nullptr)
+    {
+        LogE("Can't open the trace file: %s", fileName.c_str());
+        return;
+    }
+
+    const size_t written = fwrite(trace.data(), 1, trace.size(), file);
+    fclose(file);
+    if (written != trace.size())
+        LogE("Can't write the trace file: %s", fileName.c_str());
+    else
+        LogI("The profiler trace is saved: %s", fileName.c_str());
+}
+
+} // Pacman namespace
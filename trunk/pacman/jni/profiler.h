@@ -0,0 +1,85 @@
+#pragma once
+
+#include <string>
+
+#include "base.h"
+#include "allocation_tracker.h"
+
+namespace Pacman {
+
+// the profile scopes count the allocations too (PACMAN_ALLOCATION_TRACKING)
+#ifdef PACMAN_PROFILER
+    #define PACMAN_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define PACMAN_PROFILE_CONCAT(a, b) PACMAN_PROFILE_CONCAT_IMPL(a, b)
+
+    // name - string literal, the events keep the pointer
+    #define PACMAN_PROFILE_SCOPE(name)\
+        const ProfileScope PACMAN_PROFILE_CONCAT(profileScope, __LINE__)(name);\
+        PACMAN_ALLOCATION_SCOPE(name)
+
+    #define PACMAN_PROFILE_THREAD_NAME(name)\
+        Profiler::SetThreadName(name);
+#else
+    #define PACMAN_PROFILE_SCOPE(name)\
+        PACMAN_ALLOCATION_SCOPE(name)
+
+    #define PACMAN_PROFILE_THREAD_NAME(name)
+#endif
+
+enum class ProfileEventType : uint8_t
+{
+    Begin,
+    End
+};
+
+struct ProfileEvent
+{
+    const char*      mName;
+    uint64_t         mTime; // Timer::GetCurrentTime
+    ProfileEventType mType;
+};
+
+// records the events of each thread into its ring buffer, the oldest events are overwritten
+struct Profiler
+{
+    static const size_t kThreadEventsCapacity = 32768;
+
+    static void PushEvent(const char* name, const ProfileEventType type);
+
+    // name - string literal
+    static void SetThreadName(const char* name);
+
+    // trace event JSON of the recorded events of all the threads (chrome://tracing),
+    // the events can be recorded meanwhile
+    static std::string MakeChromeTrace();
+
+    static void SaveChromeTrace(const std::string& fileName);
+};
+
+class ProfileScope
+{
+public:
+
+    ProfileScope() = delete;
+
+    FORCEINLINE explicit ProfileScope(const char* name)
+        : mName(name)
+    {
+        Profiler::PushEvent(mName, ProfileEventType::Begin);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+
+    FORCEINLINE ~ProfileScope()
+    {
+        Profiler::PushEvent(mName, ProfileEventType::End);
+    }
+
+    ProfileScope& operator= (const ProfileScope&) = delete;
+
+private:
+
+    const char* mName;
+};
+
+} // Pacman namespace
@@ -0,0 +1,83 @@
+#include "render_queue.h"
+
+#include <algorithm>
+
+#include "drawable.h"
+#include "texture.h"
+#include "shader_program.h"
+#include "vertex_buffer.h"
+#include "utils.h"
+
+namespace Pacman {
+
+static const size_t kReservedItemsCount = 64;
+
+static const uint64_t kLayerBits         = 8;
+static const uint64_t kAlphaBlendBits    = 1;
+static const uint64_t kShaderProgramBits = 15;
+static const uint64_t kTextureBits       = 20;
+static const uint64_t kVertexBufferBits  = 20;
+
+static const uint64_t kVertexBufferShift  = 0;
+static const uint64_t kTextureShift       = kVertexBufferShift + kVertexBufferBits;
+static const uint64_t kShaderProgramShift = kTextureShift + kTextureBits;
+static const uint64_t kAlphaBlendShift    = kShaderProgramShift + kShaderProgramBits;
+static const uint64_t kLayerShift         = kAlphaBlendShift + kAlphaBlendBits;
+
+static_assert(kLayerShift + kLayerBits == 64, "Wrong render key layout");
+
+static FORCEINLINE RenderKey PackKeyField(const uint64_t value, const uint64_t bits, const uint64_t shift)
+{
+    return (value & ((uint64_t(1) << bits) - 1)) << shift;
+}
+
+static FORCEINLINE bool CompareItems(const RenderItem& first, const RenderItem& second)
+{
+    if (first.mKey != second.mKey)
+        return first.mKey < second.mKey;
+
+    return first.mSequence < second.mSequence;
+}
+
+RenderQueue::RenderQueue()
+           : mItems(),
+             mAlphaOrdering(AlphaOrdering::Submission)
+{
+    mItems.reserve(kReservedItemsCount);
+}
+
+void RenderQueue::Clear()
+{
+    // keep the capacity, the queue is refilled every frame
+    mItems.clear();
+}
+
+void RenderQueue::Push(const RenderNode& node, const IDrawable& drawable, const RenderLayer layer)
+{
+    const bool alphaBlend = drawable.HasAlphaBlend();
+
+    RenderKey key = PackKeyField(EnumCast(layer), kLayerBits, kLayerShift) |
+                    PackKeyField(alphaBlend ? 1 : 0, kAlphaBlendBits, kAlphaBlendShift);
+
+    // blended draws in the submission mode are ordered by the sequence only
+    if (!alphaBlend || (mAlphaOrdering == AlphaOrdering::State))
+    {
+        const std::shared_ptr<Texture2D> texture = drawable.GetTexture().lock();
+        const GLuint textureHandle = (texture != nullptr) ? texture->GetHandle() : 0;
+
+        key |= PackKeyField(drawable.GetShaderProgram()->GetHandle(), kShaderProgramBits, kShaderProgramShift) |
+               PackKeyField(textureHandle, kTextureBits, kTextureShift) |
+               PackKeyField(drawable.GetVertexBuffer()->GetHandle(), kVertexBufferBits, kVertexBufferShift);
+    }
+
+    const RenderItem item = { key, static_cast<uint32_t>(mItems.size()), &node, &drawable };
+    mItems.push_back(item);
+}
+
+void RenderQueue::Sort()
+{
+    // std::stable_sort may allocate a temporary buffer, the sequence makes std::sort stable
+    std::sort(mItems.begin(), mItems.end(), CompareItems);
+}
+
+} // Pacman namespace
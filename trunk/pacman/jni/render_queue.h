@@ -0,0 +1,91 @@
+#pragma once
+
+#include <vector>
+
+#include "base.h"
+#include "engine_forwdecl.h"
+
+namespace Pacman {
+
+// sort key layout (from the most significant bit):
+// [63..56] layer, [55] alpha blend, [54..40] shader program, [39..20] texture, [19..0] vertex buffer
+// every layer is drawn in two passes, the opaque draws first and the blended ones after them
+// (there is no depth buffer, so the opaque draws can't be moved in front of the lower layers)
+typedef uint64_t RenderKey;
+
+// draw order of the scene nodes, the layers are drawn back to front
+enum class RenderLayer : uint8_t
+{
+    Background = 0, // map
+    Pickups,        // dots, fruits
+    Actors,
+    HUD
+};
+
+static const size_t kRenderLayersCount = 4;
+
+enum class AlphaOrdering : uint8_t
+{
+    State,     // blended draws are sorted by the render state like the opaque ones
+    Submission // blended draws keep their submission order inside the layer (pass-stable)
+};
+
+struct RenderItem
+{
+    RenderKey         mKey;
+    uint32_t          mSequence;
+    const RenderNode* mNode;
+    const IDrawable*  mDrawable;
+};
+
+class RenderQueue
+{
+public:
+
+    typedef std::vector<RenderItem>::const_iterator const_iterator;
+
+    RenderQueue();
+    RenderQueue(const RenderQueue&) = delete;
+    ~RenderQueue() = default;
+
+    RenderQueue& operator= (const RenderQueue&) = delete;
+
+    void Clear();
+
+    void Push(const RenderNode& node, const IDrawable& drawable, const RenderLayer layer);
+
+    // sort items by the key (the submission order is used for equal keys)
+    void Sort();
+
+    void SetAlphaOrdering(const AlphaOrdering ordering)
+    {
+        mAlphaOrdering = ordering;
+    }
+
+    AlphaOrdering GetAlphaOrdering() const
+    {
+        return mAlphaOrdering;
+    }
+
+    size_t GetSize() const
+    {
+        return mItems.size();
+    }
+
+    const_iterator begin() const
+    {
+        return mItems.cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return mItems.cend();
+    }
+
+private:
+
+    std::vector<RenderItem> mItems;
+    AlphaOrdering           mAlphaOrdering;
+};
+
+} // Pacman namespace
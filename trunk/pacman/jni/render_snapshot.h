@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "base.h"
+#include "engine_forwdecl.h"
+#include "engine_typedefs.h"
+#include "render_queue.h"
+#include "scene_manager.h"
+
+namespace Pacman {
+
+// state of the attached scene node at the end of the simulation step
+struct RenderNode
+{
+    SceneNodeHandle            mHandle;
+    std::shared_ptr<IDrawable> mDrawable; // keeps the frame alive
+    const IDrawable*           mFrame;    // the drawn one (IDrawable::GetCurrentFrame)
+    Position                   mSavedPosition; // before the step
+    Position                   mPosition;
+    Position                   mPivotOffset;
+    float                      mRotation; // around the z axis
+    RenderLayer                mRenderLayer;
+};
+
+// the scene as the renderer sees it, the simulation doesn't change the published snapshot
+struct RenderSnapshot
+{
+    uint64_t                mStep;     // number of the simulation step
+    uint64_t                mStepTime; // end of the simulated time of the step, in nanoseconds
+    std::vector<RenderNode> mNodes;
+};
+
+// lock-free exchange of the latest value between one writer and one reader thread
+// the writer and the reader own a buffer each and the third one is exchanged,
+// so neither of them waits for the other and the reader always gets the last published value
+template <typename T>
+class TripleBuffer
+{
+public:
+
+    TripleBuffer()
+        : mBuffers(),
+          mExchange(1),
+          mWriteIndex(0),
+          mReadIndex(2)
+    {
+    }
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    ~TripleBuffer() = default;
+
+    TripleBuffer& operator= (const TripleBuffer&) = delete;
+
+    // writer side
+    T& GetWriteBuffer()
+    {
+        return mBuffers[mWriteIndex];
+    }
+
+    void Publish()
+    {
+        mWriteIndex = mExchange.exchange(mWriteIndex | kFreshFlag, std::memory_order_acq_rel) & kIndexMask;
+    }
+
+    // reader side, returns false if nothing was published since the last acquire
+    bool Acquire()
+    {
+        if ((mExchange.load(std::memory_order_relaxed) & kFreshFlag) == 0)
+            return false;
+
+        mReadIndex = mExchange.exchange(mReadIndex, std::memory_order_acq_rel) & kIndexMask;
+        return true;
+    }
+
+    const T& GetReadBuffer() const
+    {
+        return mBuffers[mReadIndex];
+    }
+
+private:
+
+    static const uint8_t kIndexMask = 0x3;
+    static const uint8_t kFreshFlag = 0x4; // the exchanged buffer isn't acquired yet
+
+    std::array<T, 3>     mBuffers;
+    std::atomic<uint8_t> mExchange; // index of the exchanged buffer and the fresh flag
+    uint8_t              mWriteIndex;
+    uint8_t              mReadIndex;
+};
+
+} // Pacman namespace
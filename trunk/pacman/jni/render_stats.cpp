@@ -0,0 +1,137 @@
+#include "render_stats.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+
+#include "log.h"
+
+namespace Pacman {
+
+static const std::array<const char*, kGLCountersCount> kCounterNames =
+{{
+    "draw_calls",
+    "triangles",
+    "buffer_binds",
+    "vertex_array_binds",
+    "texture_binds",
+    "program_switches",
+    "uniform_uploads",
+    "blend_toggles",
+    "uploaded_bytes"
+}};
+
+const size_t RenderStats::kFramesCount;
+
+RenderStats::RenderStats()
+           : mFrames(),
+             mFramesCount(0),
+             mLastFrame(kFramesCount - 1)
+{
+}
+
+void RenderStats::EndFrame()
+{
+    GLCounters& frameCounters = GL::GetFrameCounters();
+
+    mLastFrame = (mLastFrame + 1) % kFramesCount;
+    mFrames[mLastFrame] = frameCounters;
+    mFramesCount = std::min(mFramesCount + 1, kFramesCount);
+
+    frameCounters.fill(0);
+}
+
+size_t RenderStats::GetLast(const GLCounter counter) const
+{
+    return (mFramesCount > 0) ? mFrames[mLastFrame][EnumCast(counter)] : 0;
+}
+
+size_t RenderStats::GetMin(const GLCounter counter) const
+{
+    if (mFramesCount == 0)
+        return 0;
+
+    size_t minValue = mFrames[0][EnumCast(counter)];
+    for (size_t i = 1; i < mFramesCount; i++)
+    {
+        minValue = std::min(minValue, mFrames[i][EnumCast(counter)]);
+    }
+
+    return minValue;
+}
+
+float RenderStats::GetAverage(const GLCounter counter) const
+{
+    if (mFramesCount == 0)
+        return 0.0f;
+
+    uint64_t sum = 0;
+    for (size_t i = 0; i < mFramesCount; i++)
+    {
+        sum += mFrames[i][EnumCast(counter)];
+    }
+
+    return static_cast<float>(sum) / static_cast<float>(mFramesCount);
+}
+
+size_t RenderStats::GetMax(const GLCounter counter) const
+{
+    size_t maxValue = 0;
+    for (size_t i = 0; i < mFramesCount; i++)
+    {
+        maxValue = std::max(maxValue, mFrames[i][EnumCast(counter)]);
+    }
+
+    return maxValue;
+}
+
+std::string RenderStats::ToString() const
+{
+    std::ostringstream stream;
+    stream << "render stats of " << mFramesCount << " frames (last/min/avg/max)\n";
+
+    typedef EnumType<GLCounter>::value GLCounterValueT;
+    for (size_t i = 0; i < kGLCountersCount; i++)
+    {
+        const GLCounter counter = MakeEnum<GLCounter>(static_cast<GLCounterValueT>(i));
+        stream << GetCounterName(counter) << ": " << GetLast(counter) << " / " << GetMin(counter) << " / "
+               << GetAverage(counter) << " / " << GetMax(counter) << "\n";
+    }
+
+    return stream.str();
+}
+
+void RenderStats::Log() const
+{
+    std::istringstream stream(ToString());
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        LogI("%s", line.c_str());
+    }
+}
+
+void RenderStats::Save(const std::string& fileName) const
+{
+    const std::string stats = ToString();
+
+    // the stats are a diagnostic, their failure doesn't terminate the game
+    FILE* file = fopen(fileName.c_str(), "wb");
+    if (file == nullptr)
+    {
+        LogE("Can't open the render stats file: %s", fileName.c_str());
+        return;
+    }
+
+    const size_t written = fwrite(stats.data(), 1, stats.size(), file);
+    fclose(file);
+    if (written != stats.size())
+        LogE("Can't write the render stats file: %s", fileName.c_str());
+}
+
+const char* RenderStats::GetCounterName(const GLCounter counter)
+{
+    return kCounterNames[EnumCast(counter)];
+}
+
+} // Pacman namespace
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <string>
+
+#include "base.h"
+#include "gl_wrapper.h"
+
+namespace Pacman {
+
+// GL counters of the last frames with the rolling min/avg/max over kFramesCount frames
+class RenderStats
+{
+public:
+
+    static const size_t kFramesCount = 120;
+
+    RenderStats();
+    RenderStats(const RenderStats&) = delete;
+    ~RenderStats() = default;
+
+    RenderStats& operator= (const RenderStats&) = delete;
+
+    // takes the GL counters since the last call and resets them
+    void EndFrame();
+
+    size_t GetLast(const GLCounter counter) const;
+
+    size_t GetMin(const GLCounter counter) const;
+
+    float GetAverage(const GLCounter counter) const;
+
+    size_t GetMax(const GLCounter counter) const;
+
+    size_t GetFramesCount() const
+    {
+        return mFramesCount;
+    }
+
+    // one counter per line
+    std::string ToString() const;
+
+    void Log() const;
+
+    void Save(const std::string& fileName) const;
+
+    static const char* GetCounterName(const GLCounter counter);
+
+private:
+
+    std::array<GLCounters, kFramesCount> mFrames; // ring buffer
+    size_t mFramesCount; // of the recorded frames, up to kFramesCount
+    size_t mLastFrame;
+};
+
+} // Pacman namespace
@@ -1,104 +1,440 @@
-#include "renderer.h"
-
-#include <GLES2/gl2.h>
-
-#include "error.h"
-#include "engine.h"
-#include "scene_manager.h"
-#include "scene_node.h"
-#include "drawable.h"
-#include "texture.h"
-#include "shader_program.h"
-#include "vertex_buffer.h"
-
-namespace Pacman {
-
-static const char* kProjectionUniformName = "mProjectionMatrix";
-static const char* kModelMatrixUniformName = "mModelMatrix";
-static const char* kModelProjMatrixUniformName = "mModelProjectionMatrix";
-
-Renderer::Renderer()
-		: mProjection(),
-		  mClearColor(Color::kBlack),
-		  mViewportWidth(0),
-		  mViewportHeight(0),
-          mLastTexture(nullptr),
-          mLastShaderProgram(nullptr),
-          mLastAlphaBlendState(false)
-{
-}
-
-void Renderer::Init(const size_t viewportWidth, const size_t viewportHeigth)
-{
-	mViewportWidth = viewportWidth;
-	mViewportHeight = viewportHeigth;
-
-	mProjection = Math::Matrix4f::Ortho(0.0f, static_cast<const float>(viewportWidth),
-										static_cast<const float>(viewportHeigth), 0.0f, -1.0f, 1.0f);
-
-	glViewport(0, 0, static_cast<const int>(viewportWidth), static_cast<const int>(viewportHeigth));
-	PACMAN_CHECK_GL_ERROR();
-}
-
-void Renderer::DrawFrame()
-{
-	glClearColor(mClearColor.GetRedFloat(), mClearColor.GetGreenFloat(),
-				 mClearColor.GetBlueFloat(), mClearColor.GetAlphaFloat());
-	PACMAN_CHECK_GL_ERROR();
-
-	glClear(GL_COLOR_BUFFER_BIT);
-	PACMAN_CHECK_GL_ERROR();
-
-	const SceneManager& sceneManager = GetEngine().GetSceneManager();
-	for (const std::shared_ptr<SceneNode>& node : sceneManager)
-	{
-        const IDrawable& drawable = *(node->GetDrawable());
-		RenderDrawable(drawable, node->GetModelMatrix());
-	}
-}
-
-void Renderer::RenderDrawable(const IDrawable& drawable, const Math::Matrix4f modelMatrix)
-{
-	const std::shared_ptr<VertexBuffer> vertexBuffer = drawable.GetVertexBuffer();
-	const std::shared_ptr<ShaderProgram> shaderProgram = drawable.GetShaderProgram();
-	const std::weak_ptr<Texture2D> texturePtr = drawable.GetTexture();
-	const bool hasAlphaBlend = drawable.HasAlphaBlend();
-
-	if (hasAlphaBlend && !mLastAlphaBlendState)
-	{
-		glEnable(GL_BLEND);
-		glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-        PACMAN_CHECK_GL_ERROR();
-        mLastAlphaBlendState = true;
-	}
-    else if (!hasAlphaBlend)
-    {
-        glDisable(GL_BLEND);
-        PACMAN_CHECK_GL_ERROR();
-        mLastAlphaBlendState = false;
-    }
-
-	if (const std::shared_ptr<Texture2D> texture = texturePtr.lock())
-    {
-        if (mLastTexture != texture.get())
-        {
-		    texture->Bind();
-            mLastTexture = texture.get();
-        }
-    }
-
-    if (shaderProgram.get() != mLastShaderProgram)
-    {
-	    shaderProgram->Bind();
-        mLastShaderProgram = shaderProgram.get();
-    }
-
-	Math::Matrix4f modelProjection = (mProjection * modelMatrix).Transpose();
-	shaderProgram->SetUniform(kModelProjMatrixUniformName, modelProjection);
-
-	vertexBuffer->Bind();
-	vertexBuffer->Draw();
-	vertexBuffer->Unbind();
-}
-
-} // Pacman namespace
+#include "renderer.h"
+
+#include <GLES2/gl2.h>
+#include <algorithm>
+#include <limits>
+
+#include "error.h"
+#include "gl_wrapper.h"
+#include "utils.h"
+#include "engine.h"
+#include "profiler.h"
+#include "render_snapshot.h"
+#include "drawable.h"
+#include "texture.h"
+#include "shader_program.h"
+#include "vertex_buffer.h"
+#include "sprite_batch.h"
+#include "vertex_layout_cache.h"
+#include "static_layer_cache.h"
+
+namespace Pacman {
+
+static const char* kProjectionUniformName = "mProjectionMatrix";
+static const char* kModelMatrixUniformName = "mModelMatrix";
+static const char* kModelProjMatrixUniformName = "mModelProjectionMatrix";
+static const char* kModelProjRowsUniformName = "mModelProjectionRows";
+static const char* kAlphaPlaneUniformName = "alphaTexture";
+static const Math::Vector4f kIdentityQuadRect = Math::Vector4f(0.0f, 0.0f, 1.0f, 1.0f); // x, y, width, height
+
+static FORCEINLINE bool IsStaticLayer(const RenderLayer layer)
+{
+	return (layer == RenderLayer::Background) || (layer == RenderLayer::Pickups);
+}
+
+Renderer::Renderer()
+		: mProjection(Math::Affine2Df::kIdentity),
+		  mProjectionVersion(0),
+		  mInterpolation(1.0f),
+		  mNodeTransforms(),
+		  mMatrixRecomputationsCount(0),
+		  mLayerStats(),
+		  mBlendStateChangesCount(0),
+		  mRenderStats(),
+		  mCurrentLayer(RenderLayer::Background),
+		  mClearColor(Color::kBlack),
+		  mViewportWidth(0),
+		  mViewportHeight(0),
+		  mRenderQueue(),
+		  mSpriteBatch(nullptr),
+		  mSpriteBatching(true),
+		  mStaticLayerCache(nullptr),
+		  mStaticItemStates(),
+		  mStaticLayerCaching(true),
+          mLastTexture(nullptr),
+          mLastShaderProgram(nullptr),
+          mModelProjHandle(kInvalidUniformHandle),
+          mModelProjRowsHandle(kInvalidUniformHandle),
+          mSpriteRectHandle(kInvalidUniformHandle),
+          mTextureRegionHandle(kInvalidUniformHandle),
+          mLastAlphaBlendState(false)
+{
+}
+
+Renderer::~Renderer()
+{
+}
+
+void Renderer::Init(const size_t viewportWidth, const size_t viewportHeigth)
+{
+	mViewportWidth = viewportWidth;
+	mViewportHeight = viewportHeigth;
+
+	mProjection = Math::Affine2Df::Ortho(0.0f, static_cast<const float>(viewportWidth),
+										 static_cast<const float>(viewportHeigth), 0.0f);
+	mProjectionVersion++;
+
+	glViewport(0, 0, static_cast<const int>(viewportWidth), static_cast<const int>(viewportHeigth));
+	PACMAN_CHECK_GL_ERROR();
+
+	// the blend function is never changed, only the blending is switched
+	GL::Disable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	PACMAN_CHECK_GL_ERROR();
+	mLastAlphaBlendState = false;
+
+	// a new GL context has a default vertex layout
+	VertexLayoutCache::Init(VertexLayoutCache::MakeDefaultApi());
+	mSpriteBatch = MakeUnique<SpriteBatch>();
+	mStaticLayerCache = nullptr;
+}
+
+void Renderer::DrawFrame(const RenderSnapshot& snapshot, const float interpolation)
+{
+	PACMAN_PROFILE_SCOPE("Render.DrawFrame");
+
+	glClearColor(mClearColor.GetRedFloat(), mClearColor.GetGreenFloat(),
+				 mClearColor.GetBlueFloat(), mClearColor.GetAlphaFloat());
+	PACMAN_CHECK_GL_ERROR();
+
+	glClear(GL_COLOR_BUFFER_BIT);
+	PACMAN_CHECK_GL_ERROR();
+
+	// collect the frame draws and submit them in the render state order
+	mRenderQueue.Clear();
+	mMatrixRecomputationsCount = 0;
+	mBlendStateChangesCount = 0;
+	for (RenderLayerStats& stats : mLayerStats)
+	{
+		stats = { 0, 0, 0 };
+	}
+	mCurrentLayer = RenderLayer::Background;
+	mInterpolation = interpolation;
+
+	{
+		PACMAN_PROFILE_SCOPE("Render.BuildQueue");
+		for (const RenderNode& node : snapshot.mNodes)
+		{
+			mRenderQueue.Push(node, *node.mFrame, node.mRenderLayer);
+		}
+
+		mRenderQueue.Sort();
+	}
+
+	if (!mStaticLayerCaching)
+	{
+		DrawItems(mRenderQueue.begin(), mRenderQueue.end());
+	}
+	else
+	{
+		// the queue is sorted by the layer, so the static items go first
+		const RenderQueue::const_iterator dynamicBegin = std::find_if(mRenderQueue.begin(), mRenderQueue.end(), [](const RenderItem& item)
+		{
+			return !IsStaticLayer(item.mNode->mRenderLayer);
+		});
+
+		UpdateStaticLayerCache(mRenderQueue.begin(), dynamicBegin);
+		DrawStaticLayerCache();
+		DrawItems(dynamicBegin, mRenderQueue.end());
+	}
+
+	// the uploads of the render commands and the loading are counted by the frame too
+	mRenderStats.EndFrame();
+}
+
+const RenderLayerStats& Renderer::GetLayerStats(const RenderLayer layer) const
+{
+	return mLayerStats[EnumCast(layer)];
+}
+
+void Renderer::SetStaticLayerCaching(const bool enabled)
+{
+	mStaticLayerCaching = enabled;
+	if (!enabled)
+	{
+		mStaticLayerCache = nullptr;
+		mStaticItemStates.clear();
+	}
+}
+
+void Renderer::InvalidateStaticRegion(const SpriteRegion& region)
+{
+	// a new cache is drawn entirely
+	if (mStaticLayerCache != nullptr)
+		mStaticLayerCache->InvalidateRegion(region);
+}
+
+void Renderer::InvalidateStaticLayers()
+{
+	if (mStaticLayerCache != nullptr)
+		mStaticLayerCache->Invalidate();
+}
+
+void Renderer::DrawItems(const RenderQueue::const_iterator begin, const RenderQueue::const_iterator end)
+{
+	PACMAN_PROFILE_SCOPE("Render.DrawItems");
+
+	for (RenderQueue::const_iterator iter = begin; iter != end; ++iter)
+	{
+		const RenderItem& item = *iter;
+
+		// the batch doesn't cross the layers, so the draw calls are counted exactly
+		const RenderLayer layer = item.mNode->mRenderLayer;
+		if (layer != mCurrentLayer)
+		{
+			FlushSpriteBatch();
+			mCurrentLayer = layer;
+		}
+
+		RenderLayerStats& stats = mLayerStats[EnumCast(layer)];
+		stats.mItemsCount++;
+		if (item.mDrawable->HasAlphaBlend())
+			stats.mBlendedItemsCount++;
+
+		const SpriteQuad* quad = mSpriteBatching ? item.mDrawable->GetSpriteQuad() : nullptr;
+		if (quad != nullptr)
+		{
+			BatchDrawable(*item.mDrawable, *quad, GetModelTransform(*item.mNode));
+		}
+		else
+		{
+			// keep the draw order, the batch is behind the drawable
+			FlushSpriteBatch();
+			RenderDrawable(*item.mDrawable, *item.mNode);
+		}
+	}
+
+	FlushSpriteBatch();
+}
+
+void Renderer::UpdateStaticLayerCache(const RenderQueue::const_iterator begin, const RenderQueue::const_iterator end)
+{
+	PACMAN_PROFILE_SCOPE("Render.UpdateStaticLayerCache");
+
+	if (mStaticLayerCache == nullptr)
+	{
+		mStaticLayerCache = MakeUnique<StaticLayerCache>(mViewportWidth, mViewportHeight);
+		mStaticItemStates.clear();
+
+		// the cache resources creation binds them
+		mLastTexture = nullptr;
+		mLastShaderProgram = nullptr;
+	}
+
+	// attached, detached or moved static nodes redraw the whole cache
+	bool changed = (mStaticItemStates.size() != static_cast<size_t>(end - begin));
+	for (RenderQueue::const_iterator iter = begin; (iter != end) && !changed; ++iter)
+	{
+		const StaticItemState& state = mStaticItemStates[iter - begin];
+		const SceneNodeHandle handle = iter->mNode->mHandle;
+		changed = (state.mHandle.mIndex != handle.mIndex) || (state.mHandle.mGeneration != handle.mGeneration) ||
+				  (state.mDrawable != iter->mDrawable) || (state.mPosition != iter->mNode->mPosition);
+	}
+
+	if (changed)
+	{
+		mStaticItemStates.clear();
+		for (RenderQueue::const_iterator iter = begin; iter != end; ++iter)
+		{
+			const StaticItemState state = { iter->mNode->mHandle, iter->mDrawable, iter->mNode->mPosition };
+			mStaticItemStates.push_back(state);
+		}
+
+		mStaticLayerCache->Invalidate();
+	}
+
+	if (!mStaticLayerCache->IsDirty())
+		return;
+
+	// the items are clipped by the dirty region, so the unchanged pixels are kept
+	mStaticLayerCache->BeginUpdate(mClearColor);
+	DrawItems(begin, end);
+	mStaticLayerCache->EndUpdate();
+}
+
+void Renderer::DrawStaticLayerCache()
+{
+	mCurrentLayer = RenderLayer::Background;
+
+	ShaderProgram& shaderProgram = mStaticLayerCache->GetShaderProgram();
+	ApplyRenderState(&mStaticLayerCache->GetTexture(), &shaderProgram, false);
+
+	// the quad vertices are in the screen space
+	ApplyModelProjection(shaderProgram, mProjection);
+
+	VertexBuffer& vertexBuffer = mStaticLayerCache->GetVertexBuffer();
+	vertexBuffer.Bind();
+	vertexBuffer.Draw();
+	mLayerStats[EnumCast(mCurrentLayer)].mDrawCallsCount++;
+}
+
+const Math::Affine2Df& Renderer::GetModelTransform(const RenderNode& node)
+{
+	const uint32_t index = node.mHandle.mIndex;
+	if (index >= mNodeTransforms.size())
+	{
+		NodeTransform emptyTransform;
+		emptyTransform.mGeneration = std::numeric_limits<uint32_t>::max();
+		mNodeTransforms.resize(index + 1, emptyTransform);
+	}
+
+	NodeTransform& transform = mNodeTransforms[index];
+	const bool moving = (node.mSavedPosition != node.mPosition);
+	if ((transform.mGeneration == node.mHandle.mGeneration) && (transform.mSavedPosition == node.mSavedPosition) &&
+		(transform.mPosition == node.mPosition) && (transform.mPivotOffset == node.mPivotOffset) &&
+		(transform.mRotation == node.mRotation) && (!moving || (transform.mInterpolation == mInterpolation)))
+	{
+		return transform.mModelTransform;
+	}
+
+	const float savedPosX = static_cast<float>(node.mSavedPosition.GetX());
+	const float savedPosY = static_cast<float>(node.mSavedPosition.GetY());
+	const float posX = savedPosX + (static_cast<float>(node.mPosition.GetX()) - savedPosX) * mInterpolation;
+	const float posY = savedPosY + (static_cast<float>(node.mPosition.GetY()) - savedPosY) * mInterpolation;
+
+	const float pivotOffsetX = static_cast<float>(node.mPivotOffset.GetX());
+	const float pivotOffsetY = static_cast<float>(node.mPivotOffset.GetY());
+
+	transform.mGeneration = node.mHandle.mGeneration;
+	transform.mSavedPosition = node.mSavedPosition;
+	transform.mPosition = node.mPosition;
+	transform.mPivotOffset = node.mPivotOffset;
+	transform.mRotation = node.mRotation;
+	transform.mInterpolation = mInterpolation;
+	transform.mProjectionVersion = 0;
+	transform.mModelTransform = Math::Affine2Df::MakeRotation(node.mRotation, pivotOffsetX, pivotOffsetY).Translate(posX, posY);
+	return transform.mModelTransform;
+}
+
+const Math::Affine2Df& Renderer::GetModelProjectionTransform(const RenderNode& node)
+{
+	GetModelTransform(node);
+
+	NodeTransform& transform = mNodeTransforms[node.mHandle.mIndex];
+	if (transform.mProjectionVersion != mProjectionVersion)
+	{
+		transform.mModelProjTransform = mProjection * transform.mModelTransform;
+		transform.mProjectionVersion = mProjectionVersion;
+		mMatrixRecomputationsCount++;
+	}
+
+	return transform.mModelProjTransform;
+}
+
+void Renderer::RenderDrawable(const IDrawable& drawable, const RenderNode& node)
+{
+	const std::shared_ptr<VertexBuffer> vertexBuffer = drawable.GetVertexBuffer();
+	const std::shared_ptr<ShaderProgram> shaderProgram = drawable.GetShaderProgram();
+	const std::shared_ptr<Texture2D> texture = drawable.GetTexture().lock();
+
+	ApplyRenderState(texture.get(), shaderProgram.get(), drawable.HasAlphaBlend());
+
+	ApplyModelProjection(*shaderProgram, GetModelProjectionTransform(node));
+	ApplySpriteQuad(*shaderProgram, drawable.GetSpriteQuad());
+
+	vertexBuffer->Bind();
+	vertexBuffer->Draw();
+	mLayerStats[EnumCast(mCurrentLayer)].mDrawCallsCount++;
+}
+
+void Renderer::BatchDrawable(const IDrawable& drawable, const SpriteQuad& quad, const Math::Affine2Df& modelTransform)
+{
+	if (!mSpriteBatch->IsCompatible(drawable))
+	{
+		FlushSpriteBatch();
+		mSpriteBatch->Begin(drawable);
+	}
+
+	mSpriteBatch->Append(quad, modelTransform);
+}
+
+void Renderer::FlushSpriteBatch()
+{
+	if (mSpriteBatch->IsEmpty())
+		return;
+
+	ShaderProgram* shaderProgram = mSpriteBatch->GetShaderProgram();
+	ApplyRenderState(mSpriteBatch->GetTexture(), shaderProgram, mSpriteBatch->HasAlphaBlend());
+
+	// batch vertices are already in the screen space
+	ApplyModelProjection(*shaderProgram, mProjection);
+	ApplySpriteQuad(*shaderProgram, nullptr);
+
+	VertexBuffer& vertexBuffer = mSpriteBatch->Commit();
+	vertexBuffer.Bind();
+	vertexBuffer.Draw(0, mSpriteBatch->GetIndexCount());
+	mLayerStats[EnumCast(mCurrentLayer)].mDrawCallsCount++;
+
+	mSpriteBatch->Reset();
+}
+
+void Renderer::ApplyRenderState(Texture2D* texture, ShaderProgram* shaderProgram, const bool alphaBlend)
+{
+	// the opaque and the blended draws of the layer are sorted into two passes,
+	// so the blending is switched at most twice per layer
+	if (alphaBlend != mLastAlphaBlendState)
+	{
+		if (alphaBlend)
+			GL::Enable(GL_BLEND);
+		else
+			GL::Disable(GL_BLEND);
+
+		PACMAN_CHECK_GL_ERROR();
+		mLastAlphaBlendState = alphaBlend;
+		mBlendStateChangesCount++;
+	}
+
+	if ((texture != nullptr) && (mLastTexture != texture))
+	{
+		texture->Bind();
+		mLastTexture = texture;
+	}
+
+    if (shaderProgram != mLastShaderProgram)
+    {
+	    shaderProgram->Bind();
+        mLastShaderProgram = shaderProgram;
+        mModelProjHandle = shaderProgram->FindUniformHandle(kModelProjMatrixUniformName);
+        mModelProjRowsHandle = shaderProgram->FindUniformHandle(kModelProjRowsUniformName);
+        PACMAN_CHECK_ERROR2((mModelProjHandle != kInvalidUniformHandle) || (mModelProjRowsHandle != kInvalidUniformHandle),
+                            "shader program hasn't a model-projection uniform");
+        mSpriteRectHandle = shaderProgram->FindUniformHandle(kSpriteRectUniformName);
+        mTextureRegionHandle = shaderProgram->FindUniformHandle(kTextureRegionUniformName);
+
+        // the alpha plane sampler is fixed to its texture unit
+        const UniformHandle alphaPlaneHandle = shaderProgram->FindUniformHandle(kAlphaPlaneUniformName);
+        if (alphaPlaneHandle != kInvalidUniformHandle)
+            shaderProgram->SetUniform(alphaPlaneHandle, static_cast<int32_t>(Texture2D::kAlphaPlaneTextureUnit));
+    }
+}
+
+void Renderer::ApplyModelProjection(ShaderProgram& shaderProgram, const Math::Affine2Df& modelProjection)
+{
+    if (mModelProjRowsHandle != kInvalidUniformHandle)
+        shaderProgram.SetUniform(mModelProjRowsHandle, modelProjection);
+    else
+        shaderProgram.SetUniform(mModelProjHandle, modelProjection.ToMatrix4().Transpose());
+}
+
+void Renderer::ApplySpriteQuad(ShaderProgram& shaderProgram, const SpriteQuad* quad)
+{
+    if ((mSpriteRectHandle == kInvalidUniformHandle) || (mTextureRegionHandle == kInvalidUniformHandle))
+        return;
+
+    // the shader program skips the unchanged values
+    if (quad == nullptr)
+    {
+        shaderProgram.SetUniform(mSpriteRectHandle, kIdentityQuadRect);
+        shaderProgram.SetUniform(mTextureRegionHandle, kIdentityQuadRect);
+        return;
+    }
+
+    const SpriteRegion& region = quad->mRegion;
+    const TextureRegion& textureRegion = quad->mTextureRegion;
+    shaderProgram.SetUniform(mSpriteRectHandle, Math::Vector4f(static_cast<float>(region.GetPosX()), static_cast<float>(region.GetPosY()),
+                                                               static_cast<float>(region.GetWidth()), static_cast<float>(region.GetHeight())));
+    shaderProgram.SetUniform(mTextureRegionHandle, Math::Vector4f(textureRegion.GetPosX(), textureRegion.GetPosY(),
+                                                                  textureRegion.GetWidth(), textureRegion.GetHeight()));
+}
+
+} // Pacman namespace
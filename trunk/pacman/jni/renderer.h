@@ -1,53 +1,187 @@
-#pragma once
-
-#include "base.h"
-#include "engine_forwdecl.h"
-#include "color.h"
-#include "math/matrix4.h"
-
-namespace Pacman {
-
-class Renderer
-{
-public:
-
-	Renderer();
-	Renderer(const Renderer&) = delete;
-	~Renderer() = default;
-
-	Renderer& operator= (const Renderer&) = delete;
-
-	void Init(const size_t viewportWidth, const size_t viewportHeigth);
-
-	void DrawFrame();
-
-	void SetClearColor(const Color color)
-	{
-		mClearColor = color;
-	}
-
-	size_t GetViewportWidth() const
-	{
-		return mViewportWidth;
-	}
-
-	size_t GetViewportHeight() const
-	{
-		return mViewportHeight;
-	}
-
-private:
-
-	void RenderDrawable(const IDrawable& drawable, const Math::Matrix4f modelMatrix);
-
-	Math::Matrix4f mProjection;
-	Color mClearColor;
-	size_t mViewportWidth;
-	size_t mViewportHeight;
-
-    Texture2D* mLastTexture;
-    ShaderProgram* mLastShaderProgram;
-    bool mLastAlphaBlendState;
-};
-
-} // Pacman namespace
+#pragma once
+
+#include <array>
+#include <vector>
+#include <memory>
+
+#include "base.h"
+#include "engine_forwdecl.h"
+#include "engine_typedefs.h"
+#include "color.h"
+#include "render_queue.h"
+#include "render_stats.h"
+#include "scene_manager.h"
+#include "shader_program.h"
+#include "math/affine2d.h"
+
+namespace Pacman {
+
+// statistics of the last frame
+struct RenderLayerStats
+{
+	size_t mItemsCount;
+	size_t mBlendedItemsCount;
+	size_t mDrawCallsCount; // a sprite batch is one draw call
+};
+
+class Renderer
+{
+public:
+
+	Renderer();
+	Renderer(const Renderer&) = delete;
+	~Renderer();
+
+	Renderer& operator= (const Renderer&) = delete;
+
+	void Init(const size_t viewportWidth, const size_t viewportHeigth);
+
+	// interpolation - [0, 1] part of the simulation step passed since the snapshot step,
+	// the moving nodes are drawn between their saved and current positions
+	void DrawFrame(const RenderSnapshot& snapshot, const float interpolation);
+
+	void SetClearColor(const Color color)
+	{
+		mClearColor = color;
+	}
+
+	size_t GetViewportWidth() const
+	{
+		return mViewportWidth;
+	}
+
+	size_t GetViewportHeight() const
+	{
+		return mViewportHeight;
+	}
+
+	RenderQueue& GetRenderQueue()
+	{
+		return mRenderQueue;
+	}
+
+	// count of the model-projection transforms recomputed in the last frame
+	size_t GetMatrixRecomputationsCount() const
+	{
+		return mMatrixRecomputationsCount;
+	}
+
+	const RenderLayerStats& GetLayerStats(const RenderLayer layer) const;
+
+	// GL driver work of the last frames
+	const RenderStats& GetRenderStats() const
+	{
+		return mRenderStats;
+	}
+
+	// GL_BLEND switches in the last frame
+	size_t GetBlendStateChangesCount() const
+	{
+		return mBlendStateChangesCount;
+	}
+
+	// merge consecutive textured sprites with the same render state into a one draw call
+	void SetSpriteBatching(const bool enabled)
+	{
+		mSpriteBatching = enabled;
+	}
+
+	bool IsSpriteBatching() const
+	{
+		return mSpriteBatching;
+	}
+
+	// draw the background and the pickups layers into the StaticLayerCache and redraw them only when they are changed
+	// (the layers stats are counted only for the frames which redraw the cache, the composition is a one background draw call)
+	void SetStaticLayerCaching(const bool enabled);
+
+	bool IsStaticLayerCaching() const
+	{
+		return mStaticLayerCaching;
+	}
+
+	// the content changes of the static layers drawables have to be reported, the scene changes are tracked by the renderer
+	void InvalidateStaticRegion(const SpriteRegion& region);
+
+	void InvalidateStaticLayers();
+
+private:
+
+	// identifies the content of the static layers
+	struct StaticItemState
+	{
+		SceneNodeHandle  mHandle;
+		const IDrawable* mDrawable;
+		Position         mPosition;
+	};
+
+	// cached transforms of the scene node, indexed by the slot of its handle
+	struct NodeTransform
+	{
+		uint32_t        mGeneration;
+		Position        mSavedPosition;
+		Position        mPosition;
+		Position        mPivotOffset;
+		float           mRotation;
+		float           mInterpolation;
+		uint32_t        mProjectionVersion; // of the model-projection transform, 0 if it isn't valid
+		Math::Affine2Df mModelTransform;
+		Math::Affine2Df mModelProjTransform;
+	};
+
+	// the node transforms are recomputed only if the node or the projection was changed
+	// (the nodes which haven't moved during the step don't depend on the interpolation)
+	const Math::Affine2Df& GetModelTransform(const RenderNode& node);
+
+	const Math::Affine2Df& GetModelProjectionTransform(const RenderNode& node);
+
+	void DrawItems(const RenderQueue::const_iterator begin, const RenderQueue::const_iterator end);
+
+	// invalidates the cache if the static items were changed and redraws its dirty region
+	void UpdateStaticLayerCache(const RenderQueue::const_iterator begin, const RenderQueue::const_iterator end);
+
+	void DrawStaticLayerCache();
+
+	void RenderDrawable(const IDrawable& drawable, const RenderNode& node);
+
+	void BatchDrawable(const IDrawable& drawable, const SpriteQuad& quad, const Math::Affine2Df& modelTransform);
+
+	void FlushSpriteBatch();
+
+	void ApplyRenderState(Texture2D* texture, ShaderProgram* shaderProgram, const bool alphaBlend);
+
+	// the affine rows uniform is preferred, the programs with the mat4 uniform get the expanded matrix
+	void ApplyModelProjection(ShaderProgram& shaderProgram, const Math::Affine2Df& modelProjection);
+
+	// place the unit quad of the sprite shader, nullptr quad keeps the vertices as is
+	void ApplySpriteQuad(ShaderProgram& shaderProgram, const SpriteQuad* quad);
+
+	Math::Affine2Df mProjection;
+	uint32_t mProjectionVersion; // invalidates the nodes model-projection transforms
+	float mInterpolation; // of the drawn frame
+	std::vector<NodeTransform> mNodeTransforms;
+	size_t mMatrixRecomputationsCount;
+	std::array<RenderLayerStats, kRenderLayersCount> mLayerStats;
+	size_t mBlendStateChangesCount;
+	RenderStats mRenderStats;
+	RenderLayer mCurrentLayer; // of the drawn render item
+	Color mClearColor;
+	size_t mViewportWidth;
+	size_t mViewportHeight;
+	RenderQueue mRenderQueue;
+	std::unique_ptr<SpriteBatch> mSpriteBatch;
+	bool mSpriteBatching;
+	std::unique_ptr<StaticLayerCache> mStaticLayerCache; // created by the first frame
+	std::vector<StaticItemState> mStaticItemStates; // of the cached frame
+	bool mStaticLayerCaching;
+
+    Texture2D* mLastTexture;
+    ShaderProgram* mLastShaderProgram;
+    UniformHandle mModelProjHandle; // of the last shader program (mat4)
+    UniformHandle mModelProjRowsHandle; // of the last shader program (vec3[2])
+    UniformHandle mSpriteRectHandle; // of the last shader program (the sprite shader only)
+    UniformHandle mTextureRegionHandle; // of the last shader program (the sprite shader only)
+    bool mLastAlphaBlendState;
+};
+
+} // Pacman namespace
@@ -1,20 +1,136 @@
-#include "scene_manager.h"
-
-#include <algorithm>
-
-#include "error.h"
-#include "scene_node.h"
-
-namespace Pacman{
-
-void SceneManager::AttachNode(const std::shared_ptr<SceneNode> node)
-{
-    mNodes.emplace_back(std::move(node));
-}
-
-void SceneManager::DetachNode(const std::shared_ptr<SceneNode> node)
-{
-	mNodes.remove(node);
-}
-
-} // Pacman namespace
+#include "scene_manager.h"
+
+#include <limits>
+
+#include "error.h"
+#include "profiler.h"
+#include "scene_node.h"
+#include "render_snapshot.h"
+
+namespace Pacman{
+
+static const uint32_t kFreeSlot = std::numeric_limits<uint32_t>::max();
+
+SceneManager::~SceneManager()
+{
+    // nodes can outlive the manager
+    for (SceneNode* node : mNodes)
+    {
+        node->SetSceneHandle(nullptr, kInvalidSceneNodeHandle);
+    }
+}
+
+SceneNodeHandle SceneManager::AttachNode(const std::shared_ptr<SceneNode> node)
+{
+    PACMAN_CHECK_ERROR((node != nullptr) && !node->IsAttached());
+
+    uint32_t slotIndex = 0;
+    if (mFreeSlots.empty())
+    {
+        slotIndex = static_cast<uint32_t>(mSlots.size());
+        mSlots.push_back({ 0, kFreeSlot });
+    }
+    else
+    {
+        slotIndex = mFreeSlots.back();
+        mFreeSlots.pop_back();
+    }
+
+    Slot& slot = mSlots[slotIndex];
+    slot.mDenseIndex = static_cast<uint32_t>(mNodes.size());
+
+    mDenseSlots.push_back(slotIndex);
+    mNodes.push_back(node.get());
+    mDrawables.push_back(node->GetDrawable().get());
+    mOwners.push_back(std::move(node));
+
+    const SceneNodeHandle handle = { slotIndex, slot.mGeneration };
+    mNodes.back()->SetSceneHandle(this, handle);
+    return handle;
+}
+
+void SceneManager::DetachNode(const SceneNodeHandle handle)
+{
+    const uint32_t denseIndex = GetDenseIndex(handle);
+    mNodes[denseIndex]->SetSceneHandle(nullptr, kInvalidSceneNodeHandle);
+
+    // move the last node into the freed place
+    const uint32_t lastIndex = static_cast<uint32_t>(mNodes.size() - 1);
+    if (denseIndex != lastIndex)
+    {
+        mDenseSlots[denseIndex] = mDenseSlots[lastIndex];
+        mNodes[denseIndex] = mNodes[lastIndex];
+        mDrawables[denseIndex] = mDrawables[lastIndex];
+        mOwners[denseIndex] = std::move(mOwners[lastIndex]);
+        mSlots[mDenseSlots[denseIndex]].mDenseIndex = denseIndex;
+    }
+
+    mDenseSlots.pop_back();
+    mNodes.pop_back();
+    mDrawables.pop_back();
+    mOwners.pop_back();
+
+    Slot& slot = mSlots[handle.mIndex];
+    slot.mGeneration++;
+    slot.mDenseIndex = kFreeSlot;
+    mFreeSlots.push_back(handle.mIndex);
+}
+
+void SceneManager::DetachNode(const std::shared_ptr<SceneNode> node)
+{
+    PACMAN_CHECK_ERROR((node != nullptr) && (node->GetSceneManager() == this));
+    DetachNode(node->GetSceneHandle());
+}
+
+SceneNode* SceneManager::FindNode(const SceneNodeHandle handle) const
+{
+    if ((handle.mIndex >= mSlots.size()) || (mSlots[handle.mIndex].mGeneration != handle.mGeneration))
+        return nullptr;
+
+    const uint32_t denseIndex = mSlots[handle.mIndex].mDenseIndex;
+    return (denseIndex != kFreeSlot) ? mNodes[denseIndex] : nullptr;
+}
+
+void SceneManager::OnDrawableChanged(const SceneNodeHandle handle, IDrawable* drawable)
+{
+    mDrawables[GetDenseIndex(handle)] = drawable;
+}
+
+void SceneManager::SaveNodesPositions()
+{
+	for (SceneNode* node : mNodes)
+	{
+		node->SavePosition();
+	}
+}
+
+void SceneManager::FillRenderNodes(std::vector<RenderNode>& renderNodes) const
+{
+	PACMAN_PROFILE_SCOPE("Scene.FillRenderNodes");
+
+	renderNodes.resize(mNodes.size());
+	for (size_t i = 0; i < mNodes.size(); i++)
+	{
+		const SceneNode& node = *mNodes[i];
+		RenderNode& renderNode = renderNodes[i];
+		renderNode.mHandle = node.GetSceneHandle();
+		renderNode.mDrawable = node.GetDrawable();
+		renderNode.mFrame = renderNode.mDrawable->GetCurrentFrame();
+		renderNode.mSavedPosition = node.GetSavedPosition();
+		renderNode.mPosition = node.GetPosition();
+		renderNode.mPivotOffset = node.GetPivotOffset();
+		renderNode.mRotation = node.GetRotation().GetZ();
+		renderNode.mRenderLayer = node.GetRenderLayer();
+	}
+}
+
+uint32_t SceneManager::GetDenseIndex(const SceneNodeHandle handle) const
+{
+    PACMAN_CHECK_ERROR((handle.mIndex < mSlots.size()) && (mSlots[handle.mIndex].mGeneration == handle.mGeneration));
+
+    const uint32_t denseIndex = mSlots[handle.mIndex].mDenseIndex;
+    PACMAN_CHECK_ERROR(denseIndex != kFreeSlot);
+    return denseIndex;
+}
+
+} // Pacman namespace
@@ -1,45 +1,91 @@
-#pragma once
-
-#include <list>
-#include <memory>
-
-#include "base.h"
-#include "engine_forwdecl.h"
-
-namespace Pacman{
-
-class SceneManager
-{
-public:
-
-	SceneManager() = default;
-	SceneManager(const SceneManager&) = delete;
-	~SceneManager() = default;
-
-	SceneManager& operator= (const SceneManager&) = delete;
-
-	void AttachNode(const std::shared_ptr<SceneNode> node);
-
-	void DetachNode(const std::shared_ptr<SceneNode> node);
-
-private:
-
-    typedef std::list<std::shared_ptr<SceneNode>> NodesList;
-
-	 NodesList mNodes;
-
-// range-based for loop support
-public:
-
-    NodesList::const_iterator begin() const
-    {
-        return mNodes.cbegin();
-    }
-
-    NodesList::const_iterator end() const
-    {
-        return mNodes.cend();
-    }
-};
-
-} // Pacman namespace
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "base.h"
+#include "engine_forwdecl.h"
+
+namespace Pacman{
+
+// generational handle of the attached scene node
+// the slot generation is changed on the detach, so the handle of the detached node is never resolved
+struct SceneNodeHandle
+{
+    uint32_t mIndex; // slot index
+    uint32_t mGeneration;
+};
+
+static const SceneNodeHandle kInvalidSceneNodeHandle = { std::numeric_limits<uint32_t>::max(), 0 };
+
+// slot map of the scene nodes, attach and detach are O(1)
+// attached nodes and their drawables are densely packed into the parallel arrays,
+// the detach moves the last node into the freed place, so the iteration order isn't the attach one
+class SceneManager
+{
+public:
+
+	SceneManager() = default;
+	SceneManager(const SceneManager&) = delete;
+	~SceneManager();
+
+	SceneManager& operator= (const SceneManager&) = delete;
+
+	SceneNodeHandle AttachNode(const std::shared_ptr<SceneNode> node);
+
+	void DetachNode(const SceneNodeHandle handle);
+
+	void DetachNode(const std::shared_ptr<SceneNode> node);
+
+	// nullptr if the handle is stale
+	SceneNode* FindNode(const SceneNodeHandle handle) const;
+
+	// called by the attached node
+	void OnDrawableChanged(const SceneNodeHandle handle, IDrawable* drawable);
+
+	// called before the simulation step, the nodes are drawn between the saved and the current positions
+	void SaveNodesPositions();
+
+	// state of the attached nodes for the renderer (the capacity of the array is kept)
+	void FillRenderNodes(std::vector<RenderNode>& renderNodes) const;
+
+	size_t GetNodesCount() const
+	{
+		return mNodes.size();
+	}
+
+	// the drawable of the node is at the same index
+	const std::vector<SceneNode*>& GetNodes() const
+	{
+		return mNodes;
+	}
+
+	const std::vector<IDrawable*>& GetDrawables() const
+	{
+		return mDrawables;
+	}
+
+private:
+
+	struct Slot
+	{
+		uint32_t mGeneration;
+		uint32_t mDenseIndex; // kFreeSlot if the slot isn't used
+	};
+
+	// dense index of the slot, PACMAN_CHECK_ERROR if the handle is stale
+	uint32_t GetDenseIndex(const SceneNodeHandle handle) const;
+
+	std::vector<Slot>                       mSlots;
+	std::vector<uint32_t>                   mFreeSlots;
+
+	// dense arrays
+	std::vector<uint32_t>                   mDenseSlots;
+	std::vector<SceneNode*>                 mNodes;
+	std::vector<IDrawable*>                 mDrawables;
+	std::vector<std::shared_ptr<SceneNode>> mOwners;
+};
+
+} // Pacman namespace
@@ -1,72 +1,126 @@
-#pragma once
-
-#include <memory>
-
-#include "base.h"
-#include "engine_typedefs.h"
-#include "math/matrix4.h"
-#include "drawable.h"
-
-namespace Pacman {
-
-class SceneNode
-{
-public:
-
-	SceneNode() = delete;
-	SceneNode(const std::shared_ptr<IDrawable> drawable,
-              const Position& position, const Rotation& rotation);
-
-	SceneNode(const SceneNode&) = default;
-	~SceneNode() = default;
-
-	SceneNode& operator= (const SceneNode&) = default;
-
-	Math::Matrix4f GetModelMatrix();
-
-    std::shared_ptr<IDrawable> GetDrawable() const
-    {
-        return mDrawable;
-    }
-
-    void SetDrawable(const std::shared_ptr<IDrawable> drawable)
-    {
-        mDrawable = std::move(drawable);
-    }
-
-	Position GetPosition() const
-	{
-		return mPosition;
-	}
-
-	void Move(const PosOffset xOffset, const PosOffset yOffset)
-	{
-        mPosition.SetX(static_cast<const Position::value_t>(mPosition.GetX() + xOffset));
-        mPosition.SetY(static_cast<const Position::value_t>(mPosition.GetY() + yOffset));
-        mChanged = true;
-	}
-
-	void Translate(const Position& position)
-	{
-		mPosition = position;
-        mChanged = true;
-	}
-
-    void SetRotation(const Rotation& rotation, const Position& pivotOffset)
-    {
-        mRotation = rotation;
-        mPivotOffset = pivotOffset;
-        mChanged = true;
-    }
-
-private:
-	
-    Position                   mPivotOffset;
-	Position                   mPosition;
-    Rotation                   mRotation;
-    Math::Matrix4f             mModelMatrix;
-    bool                       mChanged;
-    std::shared_ptr<IDrawable> mDrawable;
-};
-
-} // Pacman namespace
+#pragma once
+
+#include <memory>
+
+#include "base.h"
+#include "engine_typedefs.h"
+#include "drawable.h"
+#include "render_queue.h"
+#include "scene_manager.h"
+
+namespace Pacman {
+
+// the transform of the node is built and cached by the renderer (the node is owned by the simulation)
+class SceneNode
+{
+public:
+
+	SceneNode() = delete;
+	SceneNode(const std::shared_ptr<IDrawable> drawable,
+              const Position& position, const Rotation& rotation);
+
+	SceneNode(const SceneNode&) = delete;
+	~SceneNode() = default;
+
+	SceneNode& operator= (const SceneNode&) = delete;
+
+    std::shared_ptr<IDrawable> GetDrawable() const
+    {
+        return mDrawable;
+    }
+
+    // the scene manager of the attached node is notified
+    void SetDrawable(const std::shared_ptr<IDrawable> drawable);
+
+    RenderLayer GetRenderLayer() const
+    {
+        return mRenderLayer;
+    }
+
+    void SetRenderLayer(const RenderLayer renderLayer)
+    {
+        mRenderLayer = renderLayer;
+    }
+
+    bool IsAttached() const
+    {
+        return mSceneManager != nullptr;
+    }
+
+    // nullptr if the node isn't attached
+    SceneManager* GetSceneManager() const
+    {
+        return mSceneManager;
+    }
+
+    SceneNodeHandle GetSceneHandle() const
+    {
+        return mSceneHandle;
+    }
+
+    // called by the scene manager on the attach and the detach
+    void SetSceneHandle(SceneManager* sceneManager, const SceneNodeHandle handle)
+    {
+        mSceneManager = sceneManager;
+        mSceneHandle = handle;
+    }
+
+	Position GetPosition() const
+	{
+		return mPosition;
+	}
+
+    // position before the last simulation step
+    Position GetSavedPosition() const
+    {
+        return mSavedPosition;
+    }
+
+    Position GetPivotOffset() const
+    {
+        return mPivotOffset;
+    }
+
+    Rotation GetRotation() const
+    {
+        return mRotation;
+    }
+
+	// the node is drawn moving from the saved position
+	void Move(const PosOffset xOffset, const PosOffset yOffset)
+	{
+        mPosition.SetX(static_cast<const Position::value_t>(mPosition.GetX() + xOffset));
+        mPosition.SetY(static_cast<const Position::value_t>(mPosition.GetY() + yOffset));
+	}
+
+	// teleport, the saved position is reset
+	void Translate(const Position& position)
+	{
+		mPosition = position;
+        mSavedPosition = position;
+	}
+
+    void SavePosition()
+    {
+        mSavedPosition = mPosition;
+    }
+
+    void SetRotation(const Rotation& rotation, const Position& pivotOffset)
+    {
+        mRotation = rotation;
+        mPivotOffset = pivotOffset;
+    }
+
+private:
+	
+    Position                   mPivotOffset;
+	Position                   mPosition;
+    Position                   mSavedPosition; // before the last simulation step
+    Rotation                   mRotation;
+    std::shared_ptr<IDrawable> mDrawable;
+    RenderLayer                mRenderLayer;
+    SceneManager*              mSceneManager;
+    SceneNodeHandle            mSceneHandle;
+};
+
+} // Pacman namespace
@@ -1,199 +1,369 @@
-#include "shader_program.h"
-
-#include <memory>
-
-#include "error.h"
-
-namespace Pacman {
-
-ShaderProgram::ShaderProgram(const std::string vertexShaderSource, const std::string fragmentShaderSource)
-			 : mVertexShader(ShaderType::VERTEX, std::move(vertexShaderSource)),
-			   mFragmentShader(ShaderType::FRAGMENT, std::move(fragmentShaderSource)),
-			   mIsLinked(false),
-			   mAttributeUniformHandles()
-{
-	mProgramHandle = glCreateProgram();
-	PACMAN_CHECK_GL_ERROR();
-	PACMAN_CHECK_ERROR(mProgramHandle != 0);
-}
-
-ShaderProgram::~ShaderProgram()
-{
-    glDeleteProgram(mProgramHandle);
-}
-
-void ShaderProgram::SetVertexShader(const std::string shaderSource)
-{
-	mVertexShader.SetSource(std::move(shaderSource));
-	mIsLinked = false;
-}
-
-void ShaderProgram::SetFragmentShader(const std::string shaderSource)
-{
-	mFragmentShader.SetSource(std::move(shaderSource));
-	mIsLinked = false;
-}
-
-void ShaderProgram::Link()
-{
-	if (mIsLinked)
-		return;
-
-	if (!mVertexShader.IsCompiled())
-		mVertexShader.Compile();
-
-	if (!mFragmentShader.IsCompiled())
-		mFragmentShader.Compile();
-
-	glAttachShader(mProgramHandle, mVertexShader.GetHandle());
-	PACMAN_CHECK_GL_ERROR();
-
-	glAttachShader(mProgramHandle, mFragmentShader.GetHandle());
-	PACMAN_CHECK_GL_ERROR();
-
-	glLinkProgram(mProgramHandle);
-
-	GLint linkStatus = GL_FALSE;
-	glGetProgramiv(mProgramHandle, GL_LINK_STATUS, &linkStatus);
-	if (linkStatus != GL_TRUE)
-	{
-		GLint infoLength = 0;
-	    glGetProgramiv(mProgramHandle, GL_INFO_LOG_LENGTH, &infoLength);
-	    if (infoLength > 0)
-	    {
-	    	std::unique_ptr<char[]> buf(new char[infoLength]);
-	        glGetProgramInfoLog(mProgramHandle, infoLength, nullptr, buf.get());
-	        PACMAN_CHECK_ERROR2(false, buf.get());
-	    }
-	    else
-	    {
-	    	PACMAN_CHECK_ERROR(false);
-	    }
-	}
-
-	mAttributeUniformHandles.clear();
-	mIsLinked = true;
-}
-
-void ShaderProgram::Bind() const
-{
-	glUseProgram(mProgramHandle);
-	PACMAN_CHECK_GL_ERROR();
-}
-
-void ShaderProgram::Unbind() const
-{
-	glUseProgram(0);
-	PACMAN_CHECK_GL_ERROR();
-}
-
-auto ConvertVertexAttributeType(const VertexAttributeType type) -> decltype(GL_FIXED)
-{
-	switch (type)
-	{
-	case VertexAttributeType::Byte:
-		return GL_BYTE;
-	case VertexAttributeType::UByte:
-		return GL_UNSIGNED_BYTE;
-	case VertexAttributeType::Short:
-		return GL_SHORT;
-	case VertexAttributeType::UShort:
-		return GL_UNSIGNED_SHORT;
-	case VertexAttributeType::Float:
-		return GL_FLOAT;
-	case VertexAttributeType::Fixed:
-		return GL_FIXED;
-	};
-}
-
-void ShaderProgram::SetVertexAttribute(const std::string& attrName, const size_t count, const VertexAttributeType attrType,
-									   const size_t offset, const byte_t* data) const
-{
-	GLint attrHandle = GetLocation(attrName, true);
-	glVertexAttribPointer(attrHandle, count, ConvertVertexAttributeType(attrType), GL_FALSE, offset, data);
-	PACMAN_CHECK_GL_ERROR();
-	glEnableVertexAttribArray(attrHandle);
-	PACMAN_CHECK_GL_ERROR();
-}
-
-void ShaderProgram::SetUniform(const std::string& uniformName, const float value) const
-{
-	GLint uniformHandle = GetLocation(uniformName, false);
-	glUniform1f(uniformHandle, value);
-	PACMAN_CHECK_GL_ERROR();
-}
-
-void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Vector2f& vector) const
-{
-	GLint uniformHandle = GetLocation(uniformName, false);
-	glUniform2f(uniformHandle, vector.GetX(), vector.GetY());
-	PACMAN_CHECK_GL_ERROR();
-}
-
-void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Vector3f& vector) const
-{
-	GLint uniformHandle = GetLocation(uniformName, false);
-	glUniform3f(uniformHandle, vector.GetX(), vector.GetY(), vector.GetZ());
-	PACMAN_CHECK_GL_ERROR();
-}
-
-void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Vector4f& vector) const
-{
-	GLint uniformHandle = GetLocation(uniformName, false);
-	glUniform4f(uniformHandle, vector.GetX(), vector.GetY(), vector.GetZ(), vector.GetW());
-	PACMAN_CHECK_GL_ERROR();
-}
-
-void ShaderProgram::SetUniform(const std::string& uniformName, const int32_t value) const
-{
-	GLint uniformHandle = GetLocation(uniformName, false);
-	glUniform1i(uniformHandle, value);
-	PACMAN_CHECK_GL_ERROR();
-}
-
-void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Vector2<int32_t>& vector) const
-{
-	GLint uniformHandle = GetLocation(uniformName, false);
-	glUniform2i(uniformHandle, vector.GetX(), vector.GetY());
-	PACMAN_CHECK_GL_ERROR();
-}
-
-void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Vector3<int32_t>& vector) const
-{
-	GLint uniformHandle = GetLocation(uniformName, false);
-	glUniform3i(uniformHandle, vector.GetX(), vector.GetY(), vector.GetZ());
-	PACMAN_CHECK_GL_ERROR();
-}
-
-void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Vector4<int32_t>& vector) const
-{
-	GLint uniformHandle = GetLocation(uniformName, false);
-	glUniform4i(uniformHandle, vector.GetX(), vector.GetY(), vector.GetZ(), vector.GetW());
-	PACMAN_CHECK_GL_ERROR();
-}
-
-void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Matrix4f& matrix) const
-{
-	GLint uniformHandle = GetLocation(uniformName, false);
-	glUniformMatrix4fv(uniformHandle, 1, GL_FALSE, matrix.GetRawData());
-	PACMAN_CHECK_GL_ERROR();
-}
-
-GLint ShaderProgram::GetLocation(const std::string& name, const bool attribute) const
-{
-	auto iter = mAttributeUniformHandles.find(name);
-	if (iter == mAttributeUniformHandles.end())
-	{
-		GLint handle = attribute ? glGetAttribLocation(mProgramHandle, name.c_str())
-								 : glGetUniformLocation(mProgramHandle, name.c_str());
-		PACMAN_CHECK_GL_ERROR();
-		PACMAN_CHECK_ERROR2(handle != -1, name.c_str());
-		auto result = mAttributeUniformHandles.insert(std::make_pair(name, handle));
-		PACMAN_CHECK_ERROR(result.second);
-		iter = result.first;
-	}
-
-	return iter->second;
-}
-
-} // Pacman namespace
+#include "shader_program.h"
+
+#include <memory>
+#include <cstring>
+#include <algorithm>
+
+#include "error.h"
+#include "gl_wrapper.h"
+
+namespace Pacman {
+
+static const char* kArraySuffix = "[0]";
+
+// array uniforms are reported with the "[0]" suffix, but are set by the plain name
+static FORCEINLINE std::string StripArraySuffix(const std::string& name)
+{
+	const size_t suffixLength = std::strlen(kArraySuffix);
+	if ((name.size() > suffixLength) && (name.compare(name.size() - suffixLength, suffixLength, kArraySuffix) == 0))
+		return name.substr(0, name.size() - suffixLength);
+
+	return name;
+}
+
+ShaderProgram::ShaderProgram(const std::string vertexShaderSource, const std::string fragmentShaderSource)
+			 : mVertexShader(ShaderType::VERTEX, std::move(vertexShaderSource)),
+			   mFragmentShader(ShaderType::FRAGMENT, std::move(fragmentShaderSource)),
+			   mIsLinked(false),
+			   mAttributeHandles(),
+			   mUniformHandles(),
+			   mUniforms()
+{
+	mProgramHandle = glCreateProgram();
+	PACMAN_CHECK_GL_ERROR();
+	PACMAN_CHECK_ERROR(mProgramHandle != 0);
+}
+
+ShaderProgram::~ShaderProgram()
+{
+    glDeleteProgram(mProgramHandle);
+}
+
+void ShaderProgram::SetVertexShader(const std::string shaderSource)
+{
+	mVertexShader.SetSource(std::move(shaderSource));
+	mIsLinked = false;
+}
+
+void ShaderProgram::SetFragmentShader(const std::string shaderSource)
+{
+	mFragmentShader.SetSource(std::move(shaderSource));
+	mIsLinked = false;
+}
+
+void ShaderProgram::Link()
+{
+	if (mIsLinked)
+		return;
+
+	if (!mVertexShader.IsCompiled())
+		mVertexShader.Compile();
+
+	if (!mFragmentShader.IsCompiled())
+		mFragmentShader.Compile();
+
+	glAttachShader(mProgramHandle, mVertexShader.GetHandle());
+	PACMAN_CHECK_GL_ERROR();
+
+	glAttachShader(mProgramHandle, mFragmentShader.GetHandle());
+	PACMAN_CHECK_GL_ERROR();
+
+	glLinkProgram(mProgramHandle);
+
+	GLint linkStatus = GL_FALSE;
+	glGetProgramiv(mProgramHandle, GL_LINK_STATUS, &linkStatus);
+	if (linkStatus != GL_TRUE)
+	{
+		GLint infoLength = 0;
+	    glGetProgramiv(mProgramHandle, GL_INFO_LOG_LENGTH, &infoLength);
+	    if (infoLength > 0)
+	    {
+	    	std::unique_ptr<char[]> buf(new char[infoLength]);
+	        glGetProgramInfoLog(mProgramHandle, infoLength, nullptr, buf.get());
+	        PACMAN_CHECK_ERROR2(false, buf.get());
+	    }
+	    else
+	    {
+	    	PACMAN_CHECK_ERROR(false);
+	    }
+	}
+
+	ResolveHandles();
+	mIsLinked = true;
+}
+
+void ShaderProgram::Bind() const
+{
+	GL::UseProgram(mProgramHandle);
+	PACMAN_CHECK_GL_ERROR();
+}
+
+void ShaderProgram::Unbind() const
+{
+	GL::UseProgram(0);
+	PACMAN_CHECK_GL_ERROR();
+}
+
+auto ConvertVertexAttributeType(const VertexAttributeType type) -> decltype(GL_FIXED)
+{
+	switch (type)
+	{
+	case VertexAttributeType::Byte:
+		return GL_BYTE;
+	case VertexAttributeType::UByte:
+		return GL_UNSIGNED_BYTE;
+	case VertexAttributeType::Short:
+		return GL_SHORT;
+	case VertexAttributeType::UShort:
+		return GL_UNSIGNED_SHORT;
+	case VertexAttributeType::Float:
+		return GL_FLOAT;
+	case VertexAttributeType::Fixed:
+		return GL_FIXED;
+	};
+}
+
+void ShaderProgram::SetVertexAttribute(const std::string& attrName, const size_t count, const VertexAttributeType attrType,
+									   const size_t offset, const byte_t* data) const
+{
+	GLint attrHandle = GetAttributeLocation(attrName);
+	glVertexAttribPointer(attrHandle, count, ConvertVertexAttributeType(attrType), GL_FALSE, offset, data);
+	PACMAN_CHECK_GL_ERROR();
+	glEnableVertexAttribArray(attrHandle);
+	PACMAN_CHECK_GL_ERROR();
+}
+
+void ShaderProgram::SetUniform(const std::string& uniformName, const float value) const
+{
+	SetUniform(GetUniformHandle(uniformName), value);
+}
+
+void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Vector2f& vector) const
+{
+	SetUniform(GetUniformHandle(uniformName), vector);
+}
+
+void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Vector3f& vector) const
+{
+	SetUniform(GetUniformHandle(uniformName), vector);
+}
+
+void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Vector4f& vector) const
+{
+	SetUniform(GetUniformHandle(uniformName), vector);
+}
+
+void ShaderProgram::SetUniform(const std::string& uniformName, const int32_t value) const
+{
+	SetUniform(GetUniformHandle(uniformName), value);
+}
+
+void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Vector2<int32_t>& vector) const
+{
+	SetUniform(GetUniformHandle(uniformName), vector);
+}
+
+void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Vector3<int32_t>& vector) const
+{
+	SetUniform(GetUniformHandle(uniformName), vector);
+}
+
+void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Vector4<int32_t>& vector) const
+{
+	SetUniform(GetUniformHandle(uniformName), vector);
+}
+
+void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Matrix4f& matrix) const
+{
+	SetUniform(GetUniformHandle(uniformName), matrix);
+}
+
+void ShaderProgram::SetUniform(const std::string& uniformName, const Math::Affine2Df& transform) const
+{
+	SetUniform(GetUniformHandle(uniformName), transform);
+}
+
+UniformHandle ShaderProgram::FindUniformHandle(const std::string& uniformName) const
+{
+	PACMAN_CHECK_ERROR2(mIsLinked, "shader program isn't linked");
+
+	auto iter = mUniformHandles.find(uniformName);
+	return (iter != mUniformHandles.end()) ? iter->second : kInvalidUniformHandle;
+}
+
+UniformHandle ShaderProgram::GetUniformHandle(const std::string& uniformName) const
+{
+	const UniformHandle handle = FindUniformHandle(uniformName);
+	PACMAN_CHECK_ERROR2(handle != kInvalidUniformHandle, uniformName.c_str());
+	return handle;
+}
+
+void ShaderProgram::SetUniform(const UniformHandle handle, const float value) const
+{
+	if (UpdateUniformValue(handle, &value, sizeof(value)))
+	{
+		GL::Uniform1f(mUniforms[handle].mLocation, value);
+		PACMAN_CHECK_GL_ERROR();
+	}
+}
+
+void ShaderProgram::SetUniform(const UniformHandle handle, const Math::Vector2f& vector) const
+{
+	const GLfloat data[] = { vector.GetX(), vector.GetY() };
+	if (UpdateUniformValue(handle, data, sizeof(data)))
+	{
+		GL::Uniform2fv(mUniforms[handle].mLocation, 1, data);
+		PACMAN_CHECK_GL_ERROR();
+	}
+}
+
+void ShaderProgram::SetUniform(const UniformHandle handle, const Math::Vector3f& vector) const
+{
+	const GLfloat data[] = { vector.GetX(), vector.GetY(), vector.GetZ() };
+	if (UpdateUniformValue(handle, data, sizeof(data)))
+	{
+		GL::Uniform3fv(mUniforms[handle].mLocation, 1, data);
+		PACMAN_CHECK_GL_ERROR();
+	}
+}
+
+void ShaderProgram::SetUniform(const UniformHandle handle, const Math::Vector4f& vector) const
+{
+	const GLfloat data[] = { vector.GetX(), vector.GetY(), vector.GetZ(), vector.GetW() };
+	if (UpdateUniformValue(handle, data, sizeof(data)))
+	{
+		GL::Uniform4fv(mUniforms[handle].mLocation, 1, data);
+		PACMAN_CHECK_GL_ERROR();
+	}
+}
+
+void ShaderProgram::SetUniform(const UniformHandle handle, const int32_t value) const
+{
+	if (UpdateUniformValue(handle, &value, sizeof(value)))
+	{
+		GL::Uniform1i(mUniforms[handle].mLocation, value);
+		PACMAN_CHECK_GL_ERROR();
+	}
+}
+
+void ShaderProgram::SetUniform(const UniformHandle handle, const Math::Vector2<int32_t>& vector) const
+{
+	const GLint data[] = { vector.GetX(), vector.GetY() };
+	if (UpdateUniformValue(handle, data, sizeof(data)))
+	{
+		GL::Uniform2iv(mUniforms[handle].mLocation, 1, data);
+		PACMAN_CHECK_GL_ERROR();
+	}
+}
+
+void ShaderProgram::SetUniform(const UniformHandle handle, const Math::Vector3<int32_t>& vector) const
+{
+	const GLint data[] = { vector.GetX(), vector.GetY(), vector.GetZ() };
+	if (UpdateUniformValue(handle, data, sizeof(data)))
+	{
+		GL::Uniform3iv(mUniforms[handle].mLocation, 1, data);
+		PACMAN_CHECK_GL_ERROR();
+	}
+}
+
+void ShaderProgram::SetUniform(const UniformHandle handle, const Math::Vector4<int32_t>& vector) const
+{
+	const GLint data[] = { vector.GetX(), vector.GetY(), vector.GetZ(), vector.GetW() };
+	if (UpdateUniformValue(handle, data, sizeof(data)))
+	{
+		GL::Uniform4iv(mUniforms[handle].mLocation, 1, data);
+		PACMAN_CHECK_GL_ERROR();
+	}
+}
+
+void ShaderProgram::SetUniform(const UniformHandle handle, const Math::Matrix4f& matrix) const
+{
+	if (UpdateUniformValue(handle, matrix.GetRawData(), sizeof(GLfloat) * kMaxUniformWords))
+	{
+		GL::UniformMatrix4fv(mUniforms[handle].mLocation, 1, GL_FALSE, matrix.GetRawData());
+		PACMAN_CHECK_GL_ERROR();
+	}
+}
+
+void ShaderProgram::SetUniform(const UniformHandle handle, const Math::Affine2Df& transform) const
+{
+	static const size_t kRowsCount = 2;
+	if (UpdateUniformValue(handle, transform.GetRawData(), sizeof(GLfloat) * kRowsCount * 3))
+	{
+		GL::Uniform3fv(mUniforms[handle].mLocation, kRowsCount, transform.GetRawData());
+		PACMAN_CHECK_GL_ERROR();
+	}
+}
+
+void ShaderProgram::ResolveHandles()
+{
+	mAttributeHandles.clear();
+	mUniformHandles.clear();
+	mUniforms.clear();
+
+	GLint attributesCount = 0;
+	GLint uniformsCount = 0;
+	GLint maxAttributeLength = 0;
+	GLint maxUniformLength = 0;
+	glGetProgramiv(mProgramHandle, GL_ACTIVE_ATTRIBUTES, &attributesCount);
+	glGetProgramiv(mProgramHandle, GL_ACTIVE_UNIFORMS, &uniformsCount);
+	glGetProgramiv(mProgramHandle, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &maxAttributeLength);
+	glGetProgramiv(mProgramHandle, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxUniformLength);
+	PACMAN_CHECK_GL_ERROR();
+
+	const GLsizei bufSize = std::max(std::max(maxAttributeLength, maxUniformLength), 1);
+	std::unique_ptr<char[]> buf(new char[bufSize]);
+
+	for (GLint i = 0; i < attributesCount; i++)
+	{
+		GLint size = 0;
+		GLenum type = 0;
+		glGetActiveAttrib(mProgramHandle, i, bufSize, nullptr, &size, &type, buf.get());
+		const GLint location = glGetAttribLocation(mProgramHandle, buf.get());
+		PACMAN_CHECK_GL_ERROR();
+		mAttributeHandles.insert(std::make_pair(std::string(buf.get()), location));
+	}
+
+	mUniforms.reserve(uniformsCount);
+	for (GLint i = 0; i < uniformsCount; i++)
+	{
+		GLint size = 0;
+		GLenum type = 0;
+		glGetActiveUniform(mProgramHandle, i, bufSize, nullptr, &size, &type, buf.get());
+		const GLint location = glGetUniformLocation(mProgramHandle, buf.get());
+		PACMAN_CHECK_GL_ERROR();
+
+		Uniform uniform;
+		uniform.mLocation = location;
+		uniform.mHasValue = false;
+		mUniforms.push_back(uniform);
+
+		const UniformHandle handle = static_cast<UniformHandle>(mUniforms.size() - 1);
+		mUniformHandles.insert(std::make_pair(StripArraySuffix(buf.get()), handle));
+	}
+}
+
+GLint ShaderProgram::GetAttributeLocation(const std::string& name) const
+{
+	PACMAN_CHECK_ERROR2(mIsLinked, "shader program isn't linked");
+
+	auto iter = mAttributeHandles.find(name);
+	PACMAN_CHECK_ERROR2(iter != mAttributeHandles.end(), name.c_str());
+	return iter->second;
+}
+
+bool ShaderProgram::UpdateUniformValue(const UniformHandle handle, const void* value, const size_t size) const
+{
+	PACMAN_CHECK_ERROR((handle >= 0) && (static_cast<size_t>(handle) < mUniforms.size()));
+	PACMAN_CHECK_ERROR(size <= sizeof(uint32_t) * kMaxUniformWords);
+
+	Uniform& uniform = mUniforms[handle];
+	if (uniform.mHasValue && (std::memcmp(uniform.mValue.data(), value, size) == 0))
+		return false;
+
+	std::memcpy(uniform.mValue.data(), value, size);
+	uniform.mHasValue = true;
+	return true;
+}
+
+} // Pacman namespace
@@ -1,78 +1,128 @@
-#pragma once
-
-#include <GLES2/gl2.h>
-#include <string>
-#include <unordered_map>
-
-#include "base.h"
-#include "shader.h"
-#include "math/vector2.h"
-#include "math/vector3.h"
-#include "math/vector4.h"
-#include "math/matrix4.h"
-#include "math/matrix4.h"
-
-namespace Pacman {
-
-enum class VertexAttributeType
-{
-	Byte,
-	UByte,
-	Short,
-	UShort,
-	Float,
-	Fixed
-};
-
-class ShaderProgram
-{
-public:
-
-	ShaderProgram() = delete;
-	ShaderProgram(const std::string vertexShaderSource, const std::string fragmentShaderSource);
-	ShaderProgram(const ShaderProgram&) = delete;
-	~ShaderProgram();
-
-	ShaderProgram& operator= (const ShaderProgram&) = delete;
-
-	void SetVertexShader(const std::string shaderSource);
-	void SetFragmentShader(const std::string shaderSource);
-
-	void Link();
-
-	void Bind() const;
-
-	void Unbind() const;
-
-	// attrName - attribute name
-	// count - number of values per vertex component
-	// attrType - attribute type
-	// offset - offset between attribute components
-	// data - data pointer
-	void SetVertexAttribute(const std::string& attrName, const size_t count, const VertexAttributeType attrType,
-							const size_t offset, const byte_t* data) const;
-
-	void SetUniform(const std::string& uniformName, const float value) const;
-	void SetUniform(const std::string& uniformName, const Math::Vector2f& vector) const;
-	void SetUniform(const std::string& uniformName, const Math::Vector3f& vector) const;
-	void SetUniform(const std::string& uniformName, const Math::Vector4f& vector) const;
-
-	void SetUniform(const std::string& uniformName, const int32_t value) const;
-	void SetUniform(const std::string& uniformName, const Math::Vector2<int32_t>& vector) const;
-	void SetUniform(const std::string& uniformName, const Math::Vector3<int32_t>& vector) const;
-	void SetUniform(const std::string& uniformName, const Math::Vector4<int32_t>& vector) const;
-
-	void SetUniform(const std::string& uniformName, const Math::Matrix4f& matrix) const;
-
-private:
-
-	GLint GetLocation(const std::string& name, const bool attribute) const;
-
-	Shader mVertexShader;
-	Shader mFragmentShader;
-	GLuint mProgramHandle;
-	bool mIsLinked;
-	mutable std::unordered_map<std::string, GLint> mAttributeUniformHandles;
-};
-
-} // Pacman namespace
+#pragma once
+
+#include <GLES2/gl2.h>
+#include <array>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "base.h"
+#include "shader.h"
+#include "math/vector2.h"
+#include "math/vector3.h"
+#include "math/vector4.h"
+#include "math/matrix4.h"
+#include "math/affine2d.h"
+
+namespace Pacman {
+
+// index of the active uniform, resolved once the program is linked
+typedef int32_t UniformHandle;
+
+static const UniformHandle kInvalidUniformHandle = -1;
+
+enum class VertexAttributeType
+{
+	Byte,
+	UByte,
+	Short,
+	UShort,
+	Float,
+	Fixed
+};
+
+class ShaderProgram
+{
+public:
+
+	ShaderProgram() = delete;
+	ShaderProgram(const std::string vertexShaderSource, const std::string fragmentShaderSource);
+	ShaderProgram(const ShaderProgram&) = delete;
+	~ShaderProgram();
+
+	ShaderProgram& operator= (const ShaderProgram&) = delete;
+
+	void SetVertexShader(const std::string shaderSource);
+	void SetFragmentShader(const std::string shaderSource);
+
+	void Link();
+
+	void Bind() const;
+
+	void Unbind() const;
+
+	GLuint GetHandle() const
+	{
+		return mProgramHandle;
+	}
+
+	// attrName - attribute name
+	// count - number of values per vertex component
+	// attrType - attribute type
+	// offset - offset between attribute components
+	// data - data pointer
+	void SetVertexAttribute(const std::string& attrName, const size_t count, const VertexAttributeType attrType,
+							const size_t offset, const byte_t* data) const;
+
+	void SetUniform(const std::string& uniformName, const float value) const;
+	void SetUniform(const std::string& uniformName, const Math::Vector2f& vector) const;
+	void SetUniform(const std::string& uniformName, const Math::Vector3f& vector) const;
+	void SetUniform(const std::string& uniformName, const Math::Vector4f& vector) const;
+
+	void SetUniform(const std::string& uniformName, const int32_t value) const;
+	void SetUniform(const std::string& uniformName, const Math::Vector2<int32_t>& vector) const;
+	void SetUniform(const std::string& uniformName, const Math::Vector3<int32_t>& vector) const;
+	void SetUniform(const std::string& uniformName, const Math::Vector4<int32_t>& vector) const;
+
+	void SetUniform(const std::string& uniformName, const Math::Matrix4f& matrix) const;
+	// vec3[2] uniform, the transform rows
+	void SetUniform(const std::string& uniformName, const Math::Affine2Df& transform) const;
+
+	// kInvalidUniformHandle if the program hasn't an active uniform with this name
+	UniformHandle FindUniformHandle(const std::string& uniformName) const;
+
+	UniformHandle GetUniformHandle(const std::string& uniformName) const;
+
+	// the glUniform* call is skipped if the uniform already has this value
+	void SetUniform(const UniformHandle handle, const float value) const;
+	void SetUniform(const UniformHandle handle, const Math::Vector2f& vector) const;
+	void SetUniform(const UniformHandle handle, const Math::Vector3f& vector) const;
+	void SetUniform(const UniformHandle handle, const Math::Vector4f& vector) const;
+
+	void SetUniform(const UniformHandle handle, const int32_t value) const;
+	void SetUniform(const UniformHandle handle, const Math::Vector2<int32_t>& vector) const;
+	void SetUniform(const UniformHandle handle, const Math::Vector3<int32_t>& vector) const;
+	void SetUniform(const UniformHandle handle, const Math::Vector4<int32_t>& vector) const;
+
+	void SetUniform(const UniformHandle handle, const Math::Matrix4f& matrix) const;
+	void SetUniform(const UniformHandle handle, const Math::Affine2Df& transform) const;
+
+private:
+
+	// max uniform size in 32-bit words (mat4)
+	static const size_t kMaxUniformWords = 16;
+
+	struct Uniform
+	{
+		GLint mLocation;
+		bool mHasValue; // the value is unknown until the first set
+		std::array<uint32_t, kMaxUniformWords> mValue;
+	};
+
+	void ResolveHandles();
+
+	GLint GetAttributeLocation(const std::string& name) const;
+
+	// update the shadow value and return true if it was changed
+	bool UpdateUniformValue(const UniformHandle handle, const void* value, const size_t size) const;
+
+	Shader mVertexShader;
+	Shader mFragmentShader;
+	GLuint mProgramHandle;
+	bool mIsLinked;
+	std::unordered_map<std::string, GLint> mAttributeHandles;
+	std::unordered_map<std::string, UniformHandle> mUniformHandles;
+	mutable std::vector<Uniform> mUniforms; // values shadow
+};
+
+} // Pacman namespace
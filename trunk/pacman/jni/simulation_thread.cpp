@@ -0,0 +1,220 @@
+#include "simulation_thread.h"
+
+#include <unistd.h>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+#include "error.h"
+#include "engine.h"
+#include "profiler.h"
+#include "scene_manager.h"
+#include "timer.h"
+
+namespace Pacman {
+
+static const uint64_t kNanosecPerMillisec = 1000000;
+static const uint64_t kNanosecPerMicrosec = 1000;
+static const useconds_t kWaitFrameSleep = 1000; // in microseconds
+static const size_t kReservedCommandsCount = 64;
+
+// locks the mutex while in the scope
+class MutexLock
+{
+public:
+
+    MutexLock() = delete;
+
+    explicit MutexLock(pthread_mutex_t& mutex)
+        : mMutex(mutex)
+    {
+        pthread_mutex_lock(&mMutex);
+    }
+
+    MutexLock(const MutexLock&) = delete;
+
+    ~MutexLock()
+    {
+        pthread_mutex_unlock(&mMutex);
+    }
+
+    MutexLock& operator= (const MutexLock&) = delete;
+
+private:
+
+    pthread_mutex_t& mMutex;
+};
+
+SimulationThread::SimulationThread(Engine& engine, const Timer& timer, const size_t simulationStep, const size_t maxStepsPerIteration)
+                : mEngine(engine),
+                  mTimer(timer),
+                  mSimulationStep(simulationStep * kNanosecPerMillisec),
+                  mMaxStepsPerIteration(maxStepsPerIteration),
+                  mSnapshots(),
+                  mThread(),
+                  mRunning(false),
+                  mFailed(false),
+                  mFrameTime(0),
+                  mStep(0),
+                  mStartTime(0),
+                  mPostedCommands(),
+                  mReadyCommands(),
+                  mError()
+{
+    const int res = pthread_mutex_init(&mMutex, nullptr);
+    PACMAN_CHECK_ERROR(res == 0);
+
+    mPostedCommands.reserve(kReservedCommandsCount);
+    mReadyCommands.reserve(kReservedCommandsCount);
+}
+
+SimulationThread::~SimulationThread()
+{
+    Stop();
+    pthread_mutex_destroy(&mMutex);
+}
+
+void SimulationThread::Start(const uint64_t startTime)
+{
+    PACMAN_CHECK_ERROR(!mRunning);
+
+    mStartTime = startTime;
+    mFrameTime = startTime;
+    PublishSnapshot(startTime);
+
+    mRunning = true;
+    const int res = pthread_create(&mThread, nullptr, &SimulationThread::ThreadFunction, this);
+    if (res != 0)
+    {
+        mRunning = false;
+        throw std::runtime_error("Can't create the simulation thread");
+    }
+}
+
+void SimulationThread::Stop()
+{
+    if (!mRunning)
+        return;
+
+    mRunning = false;
+    pthread_join(mThread, nullptr);
+}
+
+const RenderSnapshot& SimulationThread::AcquireSnapshot(const uint64_t frameTime)
+{
+    PACMAN_PROFILE_SCOPE("Render.AcquireSnapshot");
+
+    if (mFailed)
+    {
+        MutexLock lock(mMutex);
+        throw std::runtime_error(mError);
+    }
+
+    mFrameTime = frameTime;
+    if (!mSnapshots.Acquire())
+        return mSnapshots.GetReadBuffer();
+
+    // the commands are posted in the steps order
+    const RenderSnapshot& snapshot = mSnapshots.GetReadBuffer();
+    {
+        MutexLock lock(mMutex);
+        std::vector<PostedCommand>::iterator readyEnd = mPostedCommands.begin();
+        while ((readyEnd != mPostedCommands.end()) && (readyEnd->mStep <= snapshot.mStep))
+        {
+            ++readyEnd;
+        }
+
+        // moved, the copy of the command can allocate
+        mReadyCommands.assign(std::make_move_iterator(mPostedCommands.begin()), std::make_move_iterator(readyEnd));
+        mPostedCommands.erase(mPostedCommands.begin(), readyEnd);
+    }
+
+    for (const PostedCommand& command : mReadyCommands)
+    {
+        command.mCommand();
+    }
+
+    mReadyCommands.clear();
+    return snapshot;
+}
+
+void SimulationThread::PostRenderCommand(const RenderCommand& command)
+{
+    PostedCommand postedCommand = { mStep, command };
+
+    MutexLock lock(mMutex);
+    mPostedCommands.push_back(std::move(postedCommand));
+}
+
+void* SimulationThread::ThreadFunction(void* simulationThread)
+{
+    static_cast<SimulationThread*>(simulationThread)->Run();
+    return nullptr;
+}
+
+void SimulationThread::Run()
+{
+    PACMAN_PROFILE_THREAD_NAME("Simulation");
+
+    try
+    {
+        // end of the simulated time
+        uint64_t stepTime = mStartTime;
+        while (mRunning)
+        {
+            const uint64_t now = mTimer.GetNanosec();
+            if (now < stepTime + mSimulationStep)
+            {
+                usleep(static_cast<useconds_t>((stepTime + mSimulationStep - now) / kNanosecPerMicrosec));
+                continue;
+            }
+
+            // the frames aren't drawn (the application is paused), the game waits for them
+            if (stepTime > mFrameTime)
+            {
+                usleep(kWaitFrameSleep);
+                continue;
+            }
+
+            size_t stepsCount = 0;
+            while ((now >= stepTime + mSimulationStep) && (stepsCount < mMaxStepsPerIteration))
+            {
+                mStep++;
+                mEngine.SimulateStep();
+                stepTime += mSimulationStep;
+                stepsCount++;
+            }
+
+            // the time which can't be caught up is dropped, otherwise the steps would take more and more time
+            if (now >= stepTime + mSimulationStep)
+                stepTime = now - (now - stepTime) % mSimulationStep;
+
+            PublishSnapshot(stepTime);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        MutexLock lock(mMutex);
+        mError = e.what();
+        mFailed = true;
+    }
+    catch (...)
+    {
+        MutexLock lock(mMutex);
+        mError = "Unknown exception in the simulation thread";
+        mFailed = true;
+    }
+}
+
+void SimulationThread::PublishSnapshot(const uint64_t stepTime)
+{
+    PACMAN_PROFILE_SCOPE("Simulation.PublishSnapshot");
+
+    RenderSnapshot& snapshot = mSnapshots.GetWriteBuffer();
+    snapshot.mStep = mStep;
+    snapshot.mStepTime = stepTime;
+    mEngine.GetSceneManager().FillRenderNodes(snapshot.mNodes);
+    mSnapshots.Publish();
+}
+
+} // Pacman namespace
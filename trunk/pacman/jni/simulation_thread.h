@@ -0,0 +1,77 @@
+#pragma once
+
+#include <pthread.h>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "base.h"
+#include "engine_forwdecl.h"
+#include "render_snapshot.h"
+
+namespace Pacman {
+
+// runs the game simulation with the fixed step and publishes the scene as the RenderSnapshot after each step,
+// the render thread draws the last published snapshot without waiting for the simulation
+class SimulationThread
+{
+public:
+
+    // the GL calls have to be made by the render thread
+    typedef std::function<void()> RenderCommand;
+
+    SimulationThread() = delete;
+    // simulationStep in milliseconds
+    SimulationThread(Engine& engine, const Timer& timer, const size_t simulationStep, const size_t maxStepsPerIteration);
+    SimulationThread(const SimulationThread&) = delete;
+    ~SimulationThread();
+
+    SimulationThread& operator= (const SimulationThread&) = delete;
+
+    // publishes the current scene as the first snapshot, startTime - in nanoseconds of the timer
+    void Start(const uint64_t startTime);
+
+    // waits for the current step
+    void Stop();
+
+    // render thread side, runs the render commands of the acquired steps (the snapshot is valid till the next call)
+    // frameTime - in nanoseconds of the timer, the simulation doesn't run ahead of the frames more than one step
+    const RenderSnapshot& AcquireSnapshot(const uint64_t frameTime);
+
+    // simulation thread side, the command is run before the snapshot of the current step is drawn
+    void PostRenderCommand(const RenderCommand& command);
+
+private:
+
+    struct PostedCommand
+    {
+        uint64_t      mStep;
+        RenderCommand mCommand;
+    };
+
+    static void* ThreadFunction(void* simulationThread);
+
+    void Run();
+
+    void PublishSnapshot(const uint64_t stepTime);
+
+    Engine&                      mEngine;
+    const Timer&                 mTimer;
+    const uint64_t               mSimulationStep; // in nanoseconds
+    const size_t                 mMaxStepsPerIteration;
+    TripleBuffer<RenderSnapshot> mSnapshots;
+    pthread_t                    mThread;
+    std::atomic<bool>            mRunning;
+    std::atomic<bool>            mFailed;
+    std::atomic<uint64_t>        mFrameTime; // of the last acquired snapshot
+    uint64_t                     mStep; // simulated one, the simulation thread only
+    uint64_t                     mStartTime;
+
+    pthread_mutex_t              mMutex; // guards the posted commands and the error
+    std::vector<PostedCommand>   mPostedCommands;
+    std::vector<PostedCommand>   mReadyCommands; // the render thread only
+    std::string                  mError; // of the failed simulation
+};
+
+} // Pacman namespace
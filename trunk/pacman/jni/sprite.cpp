@@ -1,57 +1,119 @@
-#include "sprite.h"
-
-#include "instanced_sprite.h"
-#include "utils.h"
-
-namespace Pacman {
-
-static const std::vector<Position> kInstance = std::vector<Position>(1, Position::kZero);
-
-Sprite::~Sprite()
-{
-}
-
-Sprite::Sprite(const SpriteRegion& region, const Color leftTop, const Color rightTop, const Color leftBottom,
-			   const Color rightBottom, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend)
-	  : mInstancedSprite(MakeUnique<InstancedSprite>(region, leftTop, rightTop, leftBottom, rightBottom, shaderProgram, alphaBlend, kInstance, false))
-{
-}
-
-Sprite::Sprite(const SpriteRegion& region, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend)
-	  : mInstancedSprite(MakeUnique<InstancedSprite>(region, shaderProgram, alphaBlend, kInstance, false))
-{
-}
-
-Sprite::Sprite(const SpriteRegion& region, const TextureRegion& textureRegion, const std::shared_ptr<Texture2D> texture,
-			   const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend)
-	  : mInstancedSprite(MakeUnique<InstancedSprite>(region, textureRegion, texture, shaderProgram, alphaBlend, kInstance, false))
-{
-}
-
-Sprite::Sprite(const SpriteRegion& region, const std::shared_ptr<Texture2D> texture,
-			   const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend)
-	  : mInstancedSprite(MakeUnique<InstancedSprite>(region, texture, shaderProgram, alphaBlend, kInstance, false))
-{
-}
-
-std::shared_ptr<VertexBuffer> Sprite::GetVertexBuffer() const
-{
-	return mInstancedSprite->GetVertexBuffer();
-}
-
-std::weak_ptr<Texture2D> Sprite::GetTexture() const
-{
-	return mInstancedSprite->GetTexture();
-}
-
-std::shared_ptr<ShaderProgram> Sprite::GetShaderProgram() const
-{
-	return mInstancedSprite->GetShaderProgram();
-}
-
-bool Sprite::HasAlphaBlend() const
-{
-	return mInstancedSprite->HasAlphaBlend();
-}
-
-} // Pacman namespace
+#include "sprite.h"
+
+#include "instanced_sprite.h"
+#include "shader_program.h"
+#include "vertex_buffer.h"
+#include "utils.h"
+
+namespace Pacman {
+
+static const std::vector<Position> kInstance = std::vector<Position>(1, Position::kZero);
+static const TextureRegion kDefaultRegion = TextureRegion(Math::Vector2f::kZero, 1.0f, 1.0f);
+
+// the unit quad lives while at least one sprite uses it
+static std::weak_ptr<VertexBuffer> gUnitQuad;
+
+static std::shared_ptr<VertexBuffer> GetUnitQuad()
+{
+	std::shared_ptr<VertexBuffer> unitQuad = gUnitQuad.lock();
+	if (unitQuad != nullptr)
+		return unitQuad;
+
+	// left top, left bottom, right bottom, right top (the same order as the InstancedSprite quad)
+	const std::vector<TextureVertex> vertices = { { 0, 0, 0.0f, 0.0f }, { 0, 1, 0.0f, 1.0f },
+												  { 1, 1, 1.0f, 1.0f }, { 1, 0, 1.0f, 0.0f } };
+	const std::vector<uint16_t> indices = { 0, 1, 2, 0, 2, 3 };
+
+	unitQuad = std::make_shared<VertexBuffer>(vertices, indices, BufferUsage::Static, BufferUsage::Static);
+	gUnitQuad = unitQuad;
+	return unitQuad;
+}
+
+Sprite::~Sprite()
+{
+}
+
+Sprite::Sprite(const SpriteRegion& region, const Color leftTop, const Color rightTop, const Color leftBottom,
+			   const Color rightBottom, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend)
+	  : mInstancedSprite(MakeUnique<InstancedSprite>(region, leftTop, rightTop, leftBottom, rightBottom, shaderProgram, alphaBlend, kInstance, false)),
+		mUnitQuad(nullptr),
+		mTexture(nullptr),
+		mShaderProgram(shaderProgram),
+		mAlphaBlend(alphaBlend),
+		mQuad({ region, kDefaultRegion }),
+		mBatchable(false)
+{
+}
+
+Sprite::Sprite(const SpriteRegion& region, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend)
+	  : mInstancedSprite(MakeUnique<InstancedSprite>(region, shaderProgram, alphaBlend, kInstance, false)),
+		mUnitQuad(nullptr),
+		mTexture(nullptr),
+		mShaderProgram(shaderProgram),
+		mAlphaBlend(alphaBlend),
+		mQuad({ region, kDefaultRegion }),
+		mBatchable(false)
+{
+}
+
+Sprite::Sprite(const SpriteRegion& region, const TextureRegion& textureRegion, const std::shared_ptr<Texture2D> texture,
+			   const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend)
+	  : mInstancedSprite(nullptr),
+		mUnitQuad(nullptr),
+		mTexture(texture),
+		mShaderProgram(shaderProgram),
+		mAlphaBlend(alphaBlend),
+		mQuad({ region, textureRegion }),
+		mBatchable(true)
+{
+	InitTextureGeometry(region, textureRegion);
+}
+
+Sprite::Sprite(const SpriteRegion& region, const std::shared_ptr<Texture2D> texture,
+			   const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend)
+	  : mInstancedSprite(nullptr),
+		mUnitQuad(nullptr),
+		mTexture(texture),
+		mShaderProgram(shaderProgram),
+		mAlphaBlend(alphaBlend),
+		mQuad({ region, kDefaultRegion }),
+		mBatchable(true)
+{
+	InitTextureGeometry(region, kDefaultRegion);
+}
+
+std::shared_ptr<VertexBuffer> Sprite::GetVertexBuffer() const
+{
+	return IsUnitQuadShared() ? mUnitQuad : mInstancedSprite->GetVertexBuffer();
+}
+
+std::weak_ptr<Texture2D> Sprite::GetTexture() const
+{
+	return mTexture;
+}
+
+std::shared_ptr<ShaderProgram> Sprite::GetShaderProgram() const
+{
+	return mShaderProgram;
+}
+
+bool Sprite::HasAlphaBlend() const
+{
+	return mAlphaBlend;
+}
+
+const SpriteQuad* Sprite::GetSpriteQuad() const
+{
+	return mBatchable ? &mQuad : nullptr;
+}
+
+void Sprite::InitTextureGeometry(const SpriteRegion& region, const TextureRegion& textureRegion)
+{
+	// the renderer places the unit quad by the SpriteQuad uniforms
+	if (mShaderProgram->FindUniformHandle(kSpriteRectUniformName) != kInvalidUniformHandle)
+		mUnitQuad = GetUnitQuad();
+	else
+		mInstancedSprite = MakeUnique<InstancedSprite>(region, textureRegion, mTexture, mShaderProgram, mAlphaBlend, kInstance, false);
+}
+
+} // Pacman namespace
@@ -1,47 +1,64 @@
-#pragma once
-
-#include <memory>
-
-#include "base.h"
-#include "drawable.h"
-#include "engine_forwdecl.h"
-#include "engine_typedefs.h"
-
-namespace Pacman {
-
-class Sprite : public IDrawable
-{
-public:
-
-	Sprite() = delete;
-
-	Sprite(const SpriteRegion& region, const Color leftTop, const Color rightTop, const Color leftBottom,
-		   const Color rightBottom, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend);
-
-	Sprite(const SpriteRegion& region, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend);
-
-	Sprite(const SpriteRegion& region, const TextureRegion& textureRegion, const std::shared_ptr<Texture2D> texture,
-		   const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend);
-
-	Sprite(const SpriteRegion& region, const std::shared_ptr<Texture2D> texture,
-		   const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend);
-
-	Sprite(const Sprite&) = default;
-	~Sprite();
-
-	Sprite& operator= (const Sprite&) = default;
-
-	virtual std::shared_ptr<VertexBuffer> GetVertexBuffer() const;
-
-	virtual std::weak_ptr<Texture2D> GetTexture() const;
-
-	virtual std::shared_ptr<ShaderProgram> GetShaderProgram() const;
-
-	virtual bool HasAlphaBlend() const;
-
-private:
-
-    std::unique_ptr<InstancedSprite> mInstancedSprite;
-};
-
-} // Pacman namespace
+#pragma once
+
+#include <memory>
+
+#include "base.h"
+#include "drawable.h"
+#include "engine_forwdecl.h"
+#include "engine_typedefs.h"
+
+namespace Pacman {
+
+// textured sprites with the sprite shader (see kSpriteRectUniformName) share a one unit quad geometry,
+// their region and texture region are the per-draw uniforms, other sprites have their own vertex buffer
+class Sprite : public IDrawable
+{
+public:
+
+	Sprite() = delete;
+
+	Sprite(const SpriteRegion& region, const Color leftTop, const Color rightTop, const Color leftBottom,
+		   const Color rightBottom, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend);
+
+	Sprite(const SpriteRegion& region, const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend);
+
+	Sprite(const SpriteRegion& region, const TextureRegion& textureRegion, const std::shared_ptr<Texture2D> texture,
+		   const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend);
+
+	Sprite(const SpriteRegion& region, const std::shared_ptr<Texture2D> texture,
+		   const std::shared_ptr<ShaderProgram> shaderProgram, const bool alphaBlend);
+
+	Sprite(const Sprite&) = default;
+	~Sprite();
+
+	Sprite& operator= (const Sprite&) = default;
+
+	virtual std::shared_ptr<VertexBuffer> GetVertexBuffer() const;
+
+	virtual std::weak_ptr<Texture2D> GetTexture() const;
+
+	virtual std::shared_ptr<ShaderProgram> GetShaderProgram() const;
+
+	virtual bool HasAlphaBlend() const;
+
+	virtual const SpriteQuad* GetSpriteQuad() const;
+
+	bool IsUnitQuadShared() const
+	{
+		return mInstancedSprite == nullptr;
+	}
+
+private:
+
+	void InitTextureGeometry(const SpriteRegion& region, const TextureRegion& textureRegion);
+
+    std::unique_ptr<InstancedSprite> mInstancedSprite; // own geometry, nullptr if the unit quad is shared
+    std::shared_ptr<VertexBuffer>    mUnitQuad;
+    std::shared_ptr<Texture2D>       mTexture;
+    std::shared_ptr<ShaderProgram>   mShaderProgram;
+    bool                             mAlphaBlend;
+    SpriteQuad                       mQuad;
+    bool                             mBatchable; // only textured sprites can be batched
+};
+
+} // Pacman namespace
@@ -0,0 +1,140 @@
+#include "sprite_batch.h"
+
+#include <cstring>
+
+#include "error.h"
+#include "utils.h"
+#include "drawable.h"
+#include "texture.h"
+
+namespace Pacman {
+
+static const size_t kQuadVertexCount = 4;
+static const size_t kQuadIndexCount = 6;
+
+static std::vector<uint16_t> MakeQuadIndices()
+{
+    // the same quad topology as the InstancedSprite has
+    static const std::array<uint16_t, kQuadIndexCount> kBaseIndices = { 0, 1, 2, 0, 2, 3 };
+
+    std::vector<uint16_t> indices(kMaxBatchQuads * kQuadIndexCount);
+    for (size_t i = 0; i < kMaxBatchQuads; i++)
+    {
+        for (size_t j = 0; j < kQuadIndexCount; j++)
+        {
+            indices[i*kQuadIndexCount + j] = static_cast<uint16_t>(kBaseIndices[j] + i*kQuadVertexCount);
+        }
+    }
+
+    return indices;
+}
+
+static FORCEINLINE void FillBatchVertex(BatchVertex& vertex, const Math::Affine2Df& modelTransform,
+                                        const float x, const float y, const float u, const float v)
+{
+    vertex.x = modelTransform[0][0] * x + modelTransform[0][1] * y + modelTransform[0][2];
+    vertex.y = modelTransform[1][0] * x + modelTransform[1][1] * y + modelTransform[1][2];
+    vertex.u = u;
+    vertex.v = v;
+}
+
+SpriteBatch::SpriteBatch()
+           : mStreamBuffers(),
+             mCurrentBuffer(0),
+             mVertices(),
+             mQuadsCount(0),
+             mTexture(nullptr),
+             mShaderProgram(nullptr),
+             mAlphaBlend(false)
+{
+    static_assert(kMaxBatchQuads * kQuadVertexCount <= 0xFFFF, "Batch is too big for 16-bit indices");
+
+    mVertices.resize(kMaxBatchQuads * kQuadVertexCount);
+    const std::vector<uint16_t> indices = MakeQuadIndices();
+
+    for (std::unique_ptr<VertexBuffer>& buffer : mStreamBuffers)
+    {
+        buffer = MakeUnique<VertexBuffer>(mVertices, indices, BufferUsage::Stream, BufferUsage::Static);
+        buffer->SetOrphaning(true);
+    }
+}
+
+bool SpriteBatch::IsCompatible(const IDrawable& drawable) const
+{
+    if (IsEmpty() || (mQuadsCount == kMaxBatchQuads))
+        return false;
+
+    return (drawable.GetTexture().lock().get() == mTexture) &&
+           (drawable.GetShaderProgram().get() == mShaderProgram) &&
+           (drawable.HasAlphaBlend() == mAlphaBlend);
+}
+
+void SpriteBatch::Begin(const IDrawable& drawable)
+{
+    PACMAN_CHECK_ERROR2(IsEmpty(), "previous batch isn't drawn");
+
+    mTexture = drawable.GetTexture().lock().get();
+    mShaderProgram = drawable.GetShaderProgram().get();
+    mAlphaBlend = drawable.HasAlphaBlend();
+}
+
+void SpriteBatch::Append(const SpriteQuad& quad, const Math::Affine2Df& modelTransform)
+{
+    PACMAN_CHECK_ERROR2(mQuadsCount < kMaxBatchQuads, "batch is full");
+
+    const SpriteRegion& region = quad.mRegion;
+    const TextureRegion& texRegion = quad.mTextureRegion;
+
+    const float left = static_cast<float>(region.GetPosX());
+    const float top = static_cast<float>(region.GetPosY());
+    const float right = left + static_cast<float>(region.GetWidth());
+    const float bottom = top + static_cast<float>(region.GetHeight());
+
+    const float texLeft = texRegion.GetPosX();
+    const float texTop = texRegion.GetPosY();
+    const float texRight = texLeft + texRegion.GetWidth();
+    const float texBottom = texTop + texRegion.GetHeight();
+
+    BatchVertex* vertices = &mVertices[mQuadsCount * kQuadVertexCount];
+    FillBatchVertex(vertices[0], modelTransform, left, top, texLeft, texTop);
+    FillBatchVertex(vertices[1], modelTransform, left, bottom, texLeft, texBottom);
+    FillBatchVertex(vertices[2], modelTransform, right, bottom, texRight, texBottom);
+    FillBatchVertex(vertices[3], modelTransform, right, top, texRight, texTop);
+
+    mQuadsCount++;
+}
+
+VertexBuffer& SpriteBatch::Commit()
+{
+    PACMAN_CHECK_ERROR2(!IsEmpty(), "batch is empty");
+
+    // the previous batch may still be read by the GPU, so fill the other buffer
+    mCurrentBuffer = (mCurrentBuffer + 1) % mStreamBuffers.size();
+    VertexBuffer& buffer = *mStreamBuffers[mCurrentBuffer];
+
+    const size_t vertexCount = mQuadsCount * kQuadVertexCount;
+    const size_t dataSize = vertexCount * sizeof(BatchVertex);
+
+    // the cache capacity is kept, so the resize doesn't allocate
+    std::vector<byte_t>& vertexData = buffer.LockVertexData();
+    vertexData.resize(dataSize);
+    std::memcpy(&vertexData.front(), &mVertices.front(), dataSize);
+    buffer.UnlockVertexData(vertexCount);
+
+    return buffer;
+}
+
+void SpriteBatch::Reset()
+{
+    mQuadsCount = 0;
+    mTexture = nullptr;
+    mShaderProgram = nullptr;
+    mAlphaBlend = false;
+}
+
+size_t SpriteBatch::GetIndexCount() const
+{
+    return mQuadsCount * kQuadIndexCount;
+}
+
+} // Pacman namespace
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "base.h"
+#include "engine_forwdecl.h"
+#include "vertex_buffer.h"
+#include "math/affine2d.h"
+
+namespace Pacman {
+
+// max quads count merged into a one draw call
+static const size_t kMaxBatchQuads = 256;
+
+// merges consecutive textured quads with the same render state into a one draw call
+// vertices are transformed on the CPU and streamed into one of two buffers, so the next
+// batch never waits for the GPU reading the previous one
+class SpriteBatch
+{
+public:
+
+    SpriteBatch();
+    SpriteBatch(const SpriteBatch&) = delete;
+    ~SpriteBatch() = default;
+
+    SpriteBatch& operator= (const SpriteBatch&) = delete;
+
+    // whether the drawable can be appended to the current batch
+    bool IsCompatible(const IDrawable& drawable) const;
+
+    // start a new batch with the drawable render state (the current batch must be empty)
+    void Begin(const IDrawable& drawable);
+
+    void Append(const SpriteQuad& quad, const Math::Affine2Df& modelTransform);
+
+    // upload the batch vertices into the next stream buffer and return it
+    VertexBuffer& Commit();
+
+    // drop the batch quads (after the draw)
+    void Reset();
+
+    bool IsEmpty() const
+    {
+        return mQuadsCount == 0;
+    }
+
+    size_t GetIndexCount() const;
+
+    Texture2D* GetTexture() const
+    {
+        return mTexture;
+    }
+
+    ShaderProgram* GetShaderProgram() const
+    {
+        return mShaderProgram;
+    }
+
+    bool HasAlphaBlend() const
+    {
+        return mAlphaBlend;
+    }
+
+private:
+
+    typedef std::array<std::unique_ptr<VertexBuffer>, 2> StreamBuffersArray;
+
+    StreamBuffersArray       mStreamBuffers;
+    size_t                   mCurrentBuffer;
+    std::vector<BatchVertex> mVertices;
+    size_t                   mQuadsCount;
+    Texture2D*               mTexture;
+    ShaderProgram*           mShaderProgram;
+    bool                     mAlphaBlend;
+};
+
+} // Pacman namespace
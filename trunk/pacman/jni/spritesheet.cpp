@@ -1,36 +1,43 @@
-#include "spritesheet.h"
-
-#include "error.h"
-#include "texture.h"
-#include "shader_program.h"
-#include "engine.h"
-#include "asset_manager.h"
-
-namespace Pacman {
-
-SpriteSheet::SpriteSheet(const std::shared_ptr<Texture2D> texture, const NamedSpriteInfoArray& namedSpritesInfo)
-           : mTexture(std::move(texture))
-{
-	for (const NamedSpriteInfo& namedInfo : namedSpritesInfo)
-    {
-        mSpritesInfo.insert(namedInfo);
-    }
-}
-
-std::shared_ptr<Sprite> SpriteSheet::MakeSprite(const std::string& name, const SpriteRegion& region) const
-{
-    const SpriteInfo info = GetSpriteInfo(name);
-	AssetManager& assetManager = GetEngine().GetAssetManager();
-
-	std::shared_ptr<ShaderProgram> shaderProgram = assetManager.LoadShaderProgram(info.mVertexShaderName, info.mFragmentShaderName);
-	return std::make_shared<Sprite>(region, info.mTextureRegion, mTexture, shaderProgram, info.mAlphaBlend);
-}
-
-SpriteInfo SpriteSheet::GetSpriteInfo(const std::string& name) const
-{
-    auto iter = mSpritesInfo.find(name);
-    PACMAN_CHECK_ERROR(iter != mSpritesInfo.end());
-    return iter->second;
-}
-
+#include "spritesheet.h"
+
+#include "error.h"
+#include "texture.h"
+#include "shader_program.h"
+#include "engine.h"
+#include "asset_manager.h"
+
+namespace Pacman {
+
+SpriteSheet::SpriteSheet(const TexturePagesArray& pages, const NamedSpriteInfoArray& namedSpritesInfo)
+           : mPages(pages)
+{
+	for (const NamedSpriteInfo& namedInfo : namedSpritesInfo)
+    {
+        PACMAN_CHECK_ERROR(namedInfo.second.mPage < mPages.size());
+        mSpritesInfo.insert(namedInfo);
+    }
+}
+
+std::shared_ptr<Sprite> SpriteSheet::MakeSprite(const std::string& name, const SpriteRegion& region) const
+{
+    const SpriteInfo info = GetSpriteInfo(name);
+	AssetManager& assetManager = GetEngine().GetAssetManager();
+
+	std::shared_ptr<ShaderProgram> shaderProgram = assetManager.LoadShaderProgram(info.mVertexShaderName, info.mFragmentShaderName);
+	return std::make_shared<Sprite>(region, info.mTextureRegion, mPages[info.mPage], shaderProgram, info.mAlphaBlend);
+}
+
+SpriteInfo SpriteSheet::GetSpriteInfo(const std::string& name) const
+{
+    auto iter = mSpritesInfo.find(name);
+    PACMAN_CHECK_ERROR(iter != mSpritesInfo.end());
+    return iter->second;
+}
+
+std::shared_ptr<Texture2D> SpriteSheet::GetTexture(const size_t page) const
+{
+    PACMAN_CHECK_ERROR(page < mPages.size());
+    return mPages[page];
+}
+
 } // Pacman namespace
\ No newline at end of file
@@ -1,52 +1,61 @@
-#pragma once
-
-#include <vector>
-#include <string>
-#include <memory>
-#include <utility>
-#include <unordered_map>
-
-#include "base.h"
-#include "engine_forwdecl.h"
-#include "sprite.h"
-
-namespace Pacman {
-
-struct SpriteInfo
-{
-    TextureRegion mTextureRegion;
-    std::string   mVertexShaderName;
-    std::string   mFragmentShaderName;
-    bool          mAlphaBlend;
-};
-
-typedef std::pair<std::string, SpriteInfo> NamedSpriteInfo;
-typedef std::vector<NamedSpriteInfo> NamedSpriteInfoArray; 
-
-class SpriteSheet
-{
-public:
-
-	SpriteSheet() = delete;
-	SpriteSheet(const std::shared_ptr<Texture2D> texture, const NamedSpriteInfoArray& namedSpritesInfo);
-	SpriteSheet(const SpriteSheet&) = default;
-	~SpriteSheet() = default;
-
-	SpriteSheet& operator= (const SpriteSheet&) = default;
-
-	std::shared_ptr<Sprite> MakeSprite(const std::string& name, const SpriteRegion& region) const;
-
-    SpriteInfo GetSpriteInfo(const std::string& name) const;
-
-    std::shared_ptr<Texture2D> GetTexture() const
-    {
-        return mTexture;
-    }
-
-private:
-
-	std::unordered_map<std::string, SpriteInfo>  mSpritesInfo;
-	std::shared_ptr<Texture2D>					 mTexture;
-};
-
+#pragma once
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <utility>
+#include <unordered_map>
+
+#include "base.h"
+#include "engine_forwdecl.h"
+#include "sprite.h"
+
+namespace Pacman {
+
+struct SpriteInfo
+{
+    size_t        mPage; // atlas page index
+    TextureRegion mTextureRegion;
+    std::string   mVertexShaderName;
+    std::string   mFragmentShaderName;
+    bool          mAlphaBlend;
+};
+
+typedef std::pair<std::string, SpriteInfo> NamedSpriteInfo;
+typedef std::vector<NamedSpriteInfo> NamedSpriteInfoArray; 
+typedef std::vector<std::shared_ptr<Texture2D>> TexturePagesArray;
+
+class SpriteSheet
+{
+public:
+
+	SpriteSheet() = delete;
+	SpriteSheet(const TexturePagesArray& pages, const NamedSpriteInfoArray& namedSpritesInfo);
+	SpriteSheet(const SpriteSheet&) = default;
+	~SpriteSheet() = default;
+
+	SpriteSheet& operator= (const SpriteSheet&) = default;
+
+	std::shared_ptr<Sprite> MakeSprite(const std::string& name, const SpriteRegion& region) const;
+
+    SpriteInfo GetSpriteInfo(const std::string& name) const;
+
+    std::shared_ptr<Texture2D> GetTexture(const size_t page) const;
+
+    size_t GetPagesCount() const
+    {
+        return mPages.size();
+    }
+
+    const std::unordered_map<std::string, SpriteInfo>& GetSpritesInfo() const
+    {
+        return mSpritesInfo;
+    }
+
+private:
+
+	std::unordered_map<std::string, SpriteInfo>  mSpritesInfo;
+	TexturePagesArray                            mPages;
+};
+
 } // Pacman namespace
\ No newline at end of file
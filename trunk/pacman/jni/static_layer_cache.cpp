@@ -0,0 +1,134 @@
+#include "static_layer_cache.h"
+
+#include <vector>
+#include <algorithm>
+
+#include "error.h"
+#include "utils.h"
+#include "engine.h"
+#include "asset_manager.h"
+#include "texture.h"
+#include "shader_program.h"
+#include "vertex_buffer.h"
+
+namespace Pacman {
+
+// the texture rows go from the bottom to the top, so the quad flips the texture coordinates by the y
+static FORCEINLINE std::unique_ptr<VertexBuffer> MakeCompositeQuad(const size_t width, const size_t height)
+{
+    const uint16_t right = static_cast<uint16_t>(width);
+    const uint16_t bottom = static_cast<uint16_t>(height);
+    const std::vector<TextureVertex> vertices =
+    {
+        { 0,     0,      0.0f, 1.0f },
+        { 0,     bottom, 0.0f, 0.0f },
+        { right, bottom, 1.0f, 0.0f },
+        { right, 0,      1.0f, 1.0f }
+    };
+
+    const std::vector<uint16_t> indices = { 0, 1, 2, 0, 2, 3 };
+    return MakeUnique<VertexBuffer>(vertices, indices, BufferUsage::Static, BufferUsage::Static);
+}
+
+//===========================================================================================================
+
+StaticLayerCache::StaticLayerCache(const size_t width, const size_t height)
+                : mWidth(width),
+                  mHeight(height),
+                  mDirtyLeft(0),
+                  mDirtyTop(0),
+                  mDirtyRight(0),
+                  mDirtyBottom(0),
+                  mFramebufferHandle(0),
+                  mTexture(nullptr),
+                  mShaderProgram(nullptr),
+                  mVertexBuffer(nullptr)
+{
+    // the texture has the viewport size, so it is sampled 1:1 without the filtering
+    mTexture = MakeUnique<Texture2D>(width, height, nullptr, TextureFiltering::None, TextureRepeat::None, PixelFormat::RGBA_8888);
+
+    glGenFramebuffers(1, &mFramebufferHandle);
+    glBindFramebuffer(GL_FRAMEBUFFER, mFramebufferHandle);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTexture->GetHandle(), 0);
+    PACMAN_CHECK_GL_ERROR();
+
+    const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    PACMAN_CHECK_ERROR2(status == GL_FRAMEBUFFER_COMPLETE, "Static layer framebuffer is incomplete");
+
+    AssetManager& assetManager = GetEngine().GetAssetManager();
+    mShaderProgram = assetManager.LoadShaderProgram(AssetManager::kDefaultTextureVertexShader, AssetManager::kDefaultTextureFragmentShader);
+    mVertexBuffer = MakeCompositeQuad(width, height);
+
+    Invalidate();
+}
+
+StaticLayerCache::~StaticLayerCache()
+{
+    glDeleteFramebuffers(1, &mFramebufferHandle);
+}
+
+void StaticLayerCache::Invalidate()
+{
+    mDirtyLeft = 0;
+    mDirtyTop = 0;
+    mDirtyRight = mWidth;
+    mDirtyBottom = mHeight;
+}
+
+void StaticLayerCache::InvalidateRegion(const SpriteRegion& region)
+{
+    const size_t left = std::min(static_cast<size_t>(region.GetPosX()), mWidth);
+    const size_t top = std::min(static_cast<size_t>(region.GetPosY()), mHeight);
+    const size_t right = std::min(left + region.GetWidth(), mWidth);
+    const size_t bottom = std::min(top + region.GetHeight(), mHeight);
+    if ((left >= right) || (top >= bottom))
+        return;
+
+    // the dirty region is a bounding box of all the invalidated ones
+    if (!IsDirty())
+    {
+        mDirtyLeft = left;
+        mDirtyTop = top;
+        mDirtyRight = right;
+        mDirtyBottom = bottom;
+        return;
+    }
+
+    mDirtyLeft = std::min(mDirtyLeft, left);
+    mDirtyTop = std::min(mDirtyTop, top);
+    mDirtyRight = std::max(mDirtyRight, right);
+    mDirtyBottom = std::max(mDirtyBottom, bottom);
+}
+
+void StaticLayerCache::BeginUpdate(const Color clearColor)
+{
+    PACMAN_CHECK_ERROR(IsDirty());
+
+    glBindFramebuffer(GL_FRAMEBUFFER, mFramebufferHandle);
+    PACMAN_CHECK_GL_ERROR();
+
+    // the scissor box starts at the left bottom corner
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(static_cast<GLint>(mDirtyLeft), static_cast<GLint>(mHeight - mDirtyBottom),
+              static_cast<GLsizei>(mDirtyRight - mDirtyLeft), static_cast<GLsizei>(mDirtyBottom - mDirtyTop));
+
+    glClearColor(clearColor.GetRedFloat(), clearColor.GetGreenFloat(),
+                 clearColor.GetBlueFloat(), clearColor.GetAlphaFloat());
+    glClear(GL_COLOR_BUFFER_BIT);
+    PACMAN_CHECK_GL_ERROR();
+}
+
+void StaticLayerCache::EndUpdate()
+{
+    glDisable(GL_SCISSOR_TEST);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    PACMAN_CHECK_GL_ERROR();
+
+    mDirtyLeft = 0;
+    mDirtyTop = 0;
+    mDirtyRight = 0;
+    mDirtyBottom = 0;
+}
+
+} // Pacman namespace
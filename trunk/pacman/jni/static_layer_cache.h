@@ -0,0 +1,77 @@
+#pragma once
+
+#include <GLES2/gl2.h>
+#include <memory>
+
+#include "base.h"
+#include "engine_forwdecl.h"
+#include "engine_typedefs.h"
+#include "color.h"
+
+namespace Pacman {
+
+// render target of the static layers (RenderLayer::Background and RenderLayer::Pickups)
+// the layers are drawn into the texture only when they are changed (only the dirty region is redrawn)
+// and the texture is composited into the frame with a one full screen quad
+class StaticLayerCache
+{
+public:
+
+    StaticLayerCache() = delete;
+    // width, height - viewport size
+    StaticLayerCache(const size_t width, const size_t height);
+    StaticLayerCache(const StaticLayerCache&) = delete;
+    ~StaticLayerCache();
+
+    StaticLayerCache& operator= (const StaticLayerCache&) = delete;
+
+    // redraw the whole texture on the next update
+    void Invalidate();
+
+    // redraw the region (in the screen space) on the next update
+    void InvalidateRegion(const SpriteRegion& region);
+
+    bool IsDirty() const
+    {
+        return mDirtyLeft < mDirtyRight;
+    }
+
+    // binds the framebuffer and clears the dirty region by the color,
+    // the draws are clipped by the dirty region until the EndUpdate
+    void BeginUpdate(const Color clearColor);
+
+    // restores the default framebuffer, the texture is valid again
+    void EndUpdate();
+
+    Texture2D& GetTexture() const
+    {
+        return *mTexture;
+    }
+
+    ShaderProgram& GetShaderProgram() const
+    {
+        return *mShaderProgram;
+    }
+
+    // full screen quad with the texture
+    VertexBuffer& GetVertexBuffer() const
+    {
+        return *mVertexBuffer;
+    }
+
+private:
+
+    size_t                         mWidth;
+    size_t                         mHeight;
+    // dirty region borders in the screen space, empty if left == right
+    size_t                         mDirtyLeft;
+    size_t                         mDirtyTop;
+    size_t                         mDirtyRight;
+    size_t                         mDirtyBottom;
+    GLuint                         mFramebufferHandle;
+    std::unique_ptr<Texture2D>     mTexture;
+    std::shared_ptr<ShaderProgram> mShaderProgram;
+    std::unique_ptr<VertexBuffer>  mVertexBuffer;
+};
+
+} // Pacman namespace
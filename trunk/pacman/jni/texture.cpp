@@ -1,102 +1,179 @@
-#include "texture.h"
-
-#include "error.h"
-
-namespace Pacman {
-
-Texture2D::Texture2D(const size_t width, const size_t height, const byte_t* data,
-					 const TextureFiltering filtering, const TextureRepeat repeat,
-					 const PixelFormat pixelFormat)
-		 : mWidth(width),
-		   mHeight(height)
-{
-	glGenTextures(1, &mTextureHandle);
-	Bind();
-
-	switch (filtering)
-	{
-	case TextureFiltering::Bilinear:
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-		break;
-	case TextureFiltering::Trilinear:
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-		break;
-	case TextureFiltering::None:
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-		break;
-	}
-
-	switch (repeat)
-	{
-	case TextureRepeat::Repeat_S:
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		break;
-	case TextureRepeat::Repeat_T:
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-		break;
-	case TextureRepeat::Repeat_ST:
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-		break;
-	case TextureRepeat::None:
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		break;
-	}
-
-	GLint format = -1;
-	GLenum type = -1;
-
-	switch (pixelFormat)
-	{
-	case PixelFormat::RGB_565:
-		format = GL_RGB;
-		type = GL_UNSIGNED_SHORT_5_6_5;
-		break;
-	case PixelFormat::RGB_888:
-		format = GL_RGB;
-		type = GL_UNSIGNED_BYTE;
-		break;
-	case PixelFormat::RGBA_8888:
-		format = GL_RGBA;
-		type = GL_UNSIGNED_BYTE;
-		break;
-	case PixelFormat::RGBA_4444:
-		format = GL_RGBA;
-		type = GL_UNSIGNED_SHORT_4_4_4_4;
-		break;
-	case PixelFormat::A_8:
-		format = GL_ALPHA;
-		type = GL_UNSIGNED_BYTE;
-		break;
-	case PixelFormat::None:
-		PACMAN_CHECK_ERROR(false);
-		break;
-	}
-
-	glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, type, data);
-	PACMAN_CHECK_GL_ERROR();
-}
-
-Texture2D::~Texture2D()
-{
-    glDeleteTextures(1, &mTextureHandle);
-}
-
-void Texture2D::Bind() const
-{
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, mTextureHandle);
-	PACMAN_CHECK_GL_ERROR();
-}
-
-void Texture2D::Unbind() const
-{
-	glBindTexture(GL_TEXTURE_2D, 0);
-	PACMAN_CHECK_GL_ERROR();
-}
-
-} // Pacman namespace
+#include "texture.h"
+
+#include <GLES2/gl2ext.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "error.h"
+#include "gl_wrapper.h"
+
+namespace Pacman {
+
+// GLES3 core format, isn't declared by the GLES2 headers
+static const GLenum kCompressedRGBA8ETC2 = 0x9278;
+static const char* kETC1Extension = "GL_OES_compressed_ETC1_RGB8_texture";
+
+static FORCEINLINE GLenum GetInternalFormat(const CompressedFormat compressedFormat)
+{
+	switch (compressedFormat)
+	{
+	case CompressedFormat::ETC1_RGB8:
+		return GL_ETC1_RGB8_OES;
+	case CompressedFormat::ETC2_RGBA8:
+		return kCompressedRGBA8ETC2;
+	}
+
+	PACMAN_CHECK_ERROR(false);
+	return 0;
+}
+
+//===========================================================================================================
+
+Texture2D::Texture2D(const size_t width, const size_t height, const byte_t* data,
+					 const TextureFiltering filtering, const TextureRepeat repeat,
+					 const PixelFormat pixelFormat)
+		 : mWidth(width),
+		   mHeight(height),
+		   mAlphaPlane(nullptr)
+{
+	glGenTextures(1, &mTextureHandle);
+	Bind();
+
+	SetParameters(filtering, repeat);
+
+	GLint format = -1;
+	GLenum type = -1;
+
+	switch (pixelFormat)
+	{
+	case PixelFormat::RGB_565:
+		format = GL_RGB;
+		type = GL_UNSIGNED_SHORT_5_6_5;
+		break;
+	case PixelFormat::RGB_888:
+		format = GL_RGB;
+		type = GL_UNSIGNED_BYTE;
+		break;
+	case PixelFormat::RGBA_8888:
+		format = GL_RGBA;
+		type = GL_UNSIGNED_BYTE;
+		break;
+	case PixelFormat::RGBA_4444:
+		format = GL_RGBA;
+		type = GL_UNSIGNED_SHORT_4_4_4_4;
+		break;
+	case PixelFormat::A_8:
+		format = GL_ALPHA;
+		type = GL_UNSIGNED_BYTE;
+		break;
+	case PixelFormat::None:
+		PACMAN_CHECK_ERROR(false);
+		break;
+	}
+
+	GL::TexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, type, data);
+	PACMAN_CHECK_GL_ERROR();
+}
+
+Texture2D::Texture2D(const size_t width, const size_t height, const byte_t* data, const size_t dataSize,
+					 const TextureFiltering filtering, const TextureRepeat repeat,
+					 const CompressedFormat compressedFormat)
+		 : mWidth(width),
+		   mHeight(height),
+		   mAlphaPlane(nullptr)
+{
+	glGenTextures(1, &mTextureHandle);
+	Bind();
+
+	SetParameters((filtering == TextureFiltering::Trilinear) ? TextureFiltering::Bilinear : filtering, repeat);
+
+	GL::CompressedTexImage2D(GL_TEXTURE_2D, 0, GetInternalFormat(compressedFormat), width, height, 0, dataSize, data);
+	PACMAN_CHECK_GL_ERROR();
+}
+
+Texture2D::~Texture2D()
+{
+    glDeleteTextures(1, &mTextureHandle);
+}
+
+bool Texture2D::IsFormatSupported(const CompressedFormat compressedFormat)
+{
+	if (compressedFormat == CompressedFormat::ETC1_RGB8)
+	{
+		const char* extensions = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+		if ((extensions != nullptr) && (std::strstr(extensions, kETC1Extension) != nullptr))
+			return true;
+	}
+
+	// ETC2 has no GLES2 extension, but the GLES3 capable drivers report it in the list
+	GLint formatsCount = 0;
+	glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &formatsCount);
+	if (formatsCount <= 0)
+		return false;
+
+	std::vector<GLint> formats(formatsCount);
+	glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, &formats.front());
+	PACMAN_CHECK_GL_ERROR();
+
+	const GLint internalFormat = static_cast<GLint>(GetInternalFormat(compressedFormat));
+	return std::find(formats.begin(), formats.end(), internalFormat) != formats.end();
+}
+
+void Texture2D::Bind() const
+{
+	if (mAlphaPlane != nullptr)
+	{
+		glActiveTexture(GL_TEXTURE0 + kAlphaPlaneTextureUnit);
+		GL::BindTexture(GL_TEXTURE_2D, mAlphaPlane->GetHandle());
+	}
+
+	glActiveTexture(GL_TEXTURE0);
+	GL::BindTexture(GL_TEXTURE_2D, mTextureHandle);
+	PACMAN_CHECK_GL_ERROR();
+}
+
+void Texture2D::Unbind() const
+{
+	GL::BindTexture(GL_TEXTURE_2D, 0);
+	PACMAN_CHECK_GL_ERROR();
+}
+
+void Texture2D::SetParameters(const TextureFiltering filtering, const TextureRepeat repeat)
+{
+	switch (filtering)
+	{
+	case TextureFiltering::Bilinear:
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		break;
+	case TextureFiltering::Trilinear:
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		break;
+	case TextureFiltering::None:
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		break;
+	}
+
+	switch (repeat)
+	{
+	case TextureRepeat::Repeat_S:
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		break;
+	case TextureRepeat::Repeat_T:
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		break;
+	case TextureRepeat::Repeat_ST:
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		break;
+	case TextureRepeat::None:
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		break;
+	}
+}
+
+} // Pacman namespace
@@ -1,69 +1,108 @@
-#pragma once
-
-#include <GLES2/gl2.h>
-
-#include "base.h"
-
-namespace Pacman {
-
-enum class TextureFiltering : uint8_t
-{
-	None      = 0,
-	Bilinear  = 1,
-	Trilinear = 2
-};
-
-enum class TextureRepeat
-{
-	None = 0,
-	Repeat_S,
-	Repeat_T,
-	Repeat_ST
-};
-
-enum class PixelFormat
-{
-	None,
-	RGB_565,
-	RGB_888,
-	RGBA_8888,
-	RGBA_4444,
-	A_8
-};
-
-class Texture2D
-{
-public:
-
-	Texture2D() = delete;
-	Texture2D(const size_t width, const size_t height, const byte_t* data,
-			  const TextureFiltering filtering, const TextureRepeat repeat,
-			  const PixelFormat pixelFormat);
-
-	Texture2D(const Texture2D&) = delete;
-	~Texture2D();
-
-	Texture2D& operator= (const Texture2D&) = delete;
-
-	void Bind() const;
-
-	void Unbind() const;
-
-	size_t GetWidth() const
-	{
-		return mWidth;
-	}
-
-	size_t GetHeight() const
-	{
-		return mHeight;
-	}
-
-private:
-
-	GLuint mTextureHandle;
-	size_t mWidth;
-	size_t mHeight;
-};
-
-} // Pacman namespace
+#pragma once
+
+#include <GLES2/gl2.h>
+#include <memory>
+
+#include "base.h"
+
+namespace Pacman {
+
+enum class TextureFiltering : uint8_t
+{
+	None      = 0,
+	Bilinear  = 1,
+	Trilinear = 2
+};
+
+enum class TextureRepeat
+{
+	None = 0,
+	Repeat_S,
+	Repeat_T,
+	Repeat_ST
+};
+
+enum class PixelFormat
+{
+	None,
+	RGB_565,
+	RGB_888,
+	RGBA_8888,
+	RGBA_4444,
+	A_8
+};
+
+// block compressed formats, the data is uploaded as is
+enum class CompressedFormat
+{
+	ETC1_RGB8,  // GL_OES_compressed_ETC1_RGB8_texture, the alpha is stored in a separate alpha plane texture
+	ETC2_RGBA8  // GL_COMPRESSED_RGBA8_ETC2_EAC (GLES3 or the driver reports it in the compressed formats list)
+};
+
+class Texture2D
+{
+public:
+
+	Texture2D() = delete;
+	Texture2D(const size_t width, const size_t height, const byte_t* data,
+			  const TextureFiltering filtering, const TextureRepeat repeat,
+			  const PixelFormat pixelFormat);
+
+	// dataSize - size of the compressed base level
+	// mipmaps can't be generated for the compressed data, so the trilinear filtering falls back to the bilinear one
+	Texture2D(const size_t width, const size_t height, const byte_t* data, const size_t dataSize,
+			  const TextureFiltering filtering, const TextureRepeat repeat,
+			  const CompressedFormat compressedFormat);
+
+	Texture2D(const Texture2D&) = delete;
+	~Texture2D();
+
+	Texture2D& operator= (const Texture2D&) = delete;
+
+	// is the format supported by the current GL context
+	static bool IsFormatSupported(const CompressedFormat compressedFormat);
+
+	// binds the alpha plane (if it is set) to the kAlphaPlaneTextureUnit, the texture itself is bound to the first unit
+	void Bind() const;
+
+	void Unbind() const;
+
+	size_t GetWidth() const
+	{
+		return mWidth;
+	}
+
+	size_t GetHeight() const
+	{
+		return mHeight;
+	}
+
+	GLuint GetHandle() const
+	{
+		return mTextureHandle;
+	}
+
+	// the alpha of the ETC1 texture, shaders sample it from the kAlphaPlaneTextureUnit
+	void SetAlphaPlane(const std::shared_ptr<Texture2D> alphaPlane)
+	{
+		mAlphaPlane = alphaPlane;
+	}
+
+	bool HasAlphaPlane() const
+	{
+		return mAlphaPlane != nullptr;
+	}
+
+	static const size_t kAlphaPlaneTextureUnit = 1;
+
+private:
+
+	void SetParameters(const TextureFiltering filtering, const TextureRepeat repeat);
+
+	GLuint                     mTextureHandle;
+	size_t                     mWidth;
+	size_t                     mHeight;
+	std::shared_ptr<Texture2D> mAlphaPlane;
+};
+
+} // Pacman namespace
@@ -1,5 +1,5 @@
-#include "utils.h"
-
-namespace Pacman {
-
+#include "utils.h"
+
+namespace Pacman {
+
 } // Pacman namespace
\ No newline at end of file
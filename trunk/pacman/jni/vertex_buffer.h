@@ -1,124 +1,179 @@
-#pragma once
-
-#include <GLES2/gl2.h>
-#include <array>
-#include <vector>
-
-#include "base.h"
-#include "color.h"
-
-namespace Pacman {
-
-static const size_t kMaxVertexAttributesCount = 3;
-
-enum class BufferUsage
-{
-    Static,
-    Dynamic,
-    Stream
-};
-
-struct Vertex
-{
-	uint16_t x, y; // position
-	float    r, g, b, a; // color
-	float    u, v; // tex coords
-};
-
-struct ColorVertex 
-{
-	uint16_t x, y; // position
-	float    r, g, b, a; // color
-};
-
-struct TextureVertex
-{
-	uint16_t x, y; // position
-	float    u, v; // tex coords
-};
-
-class VertexBuffer
-{
-public:
-
-	VertexBuffer() = delete;
-	explicit VertexBuffer(const std::vector<Vertex>& vertexData, const std::vector<uint16_t>& indexData,
-                          const BufferUsage vertexBufferUsage, const BufferUsage indexBufferUsage);
-
-	explicit VertexBuffer(const std::vector<ColorVertex>& vertexData, const std::vector<uint16_t>& indexData,
-						  const BufferUsage vertexBufferUsage, const BufferUsage indexBufferUsage);
-
-	explicit VertexBuffer(const std::vector<TextureVertex>& vertexData, const std::vector<uint16_t>& indexData,
-						  const BufferUsage vertexBufferUsage, const BufferUsage indexBufferUsage);
-
-	VertexBuffer(const VertexBuffer&) = delete;
-	~VertexBuffer();
-
-	VertexBuffer& operator= (const VertexBuffer&) = delete;
-
-	void Bind() const;
-
-	void Unbind() const;
-
-	void Draw() const;
-
-    std::vector<byte_t>& LockVertexData();
-
-    void UnlockVertexData(const size_t newVertexCount);
-
-    std::vector<uint16_t>& LockIndexData();
-
-    void UnlockIndexData();
-
-    size_t GetVertexCount() const
-    {
-        return mVertexCount;
-    }
-
-    size_t GetIndexCount() const
-    {
-        return mIndexCount;
-    }
-
-    size_t GetAttributesCount() const
-    {
-        return mAttributesCount;
-    }
-
-private:
-
-	void Init(const byte_t* vertexData, const size_t vertexDataSize, const std::vector<uint16_t>& indexData,
-              const BufferUsage vertexBufferUsage, const BufferUsage indexBufferUsage);
-
-	struct VertexAttribute
-	{
-		size_t mComponentsCount;
-		size_t mStride; // in bytes
-		size_t mBeginStride; // in bytes
-        GLenum mType;
-	};
-
-	typedef std::array<VertexAttribute, kMaxVertexAttributesCount> VertexAttributesArray;
-
-	union
-	{
-		struct
-		{
-			GLuint mVertexBuffer;
-			GLuint mIndexBuffer;
-		};
-		std::array<GLuint, 2> mBuffers;
-	};
-
-	size_t                mIndexCount;
-    size_t                mVertexCount;
-	size_t                mAttributesCount;
-    bool                  mVertexDataLocked;
-    bool                  mIndexDataLocked;
-    bool                  mEmpty;
-    std::vector<byte_t>   mVertexCache;
-    std::vector<uint16_t> mIndexCache;
-	VertexAttributesArray mVertexAttributes;
-};
-
-} // Pacman namespace
+#pragma once
+
+#include <GLES2/gl2.h>
+#include <array>
+#include <vector>
+
+#include "base.h"
+#include "color.h"
+
+namespace Pacman {
+
+static const size_t kMaxVertexAttributesCount = 3;
+
+enum class BufferUsage
+{
+    Static,
+    Dynamic,
+    Stream
+};
+
+struct Vertex
+{
+	uint16_t x, y; // position
+	float    r, g, b, a; // color
+	float    u, v; // tex coords
+};
+
+struct ColorVertex 
+{
+	uint16_t x, y; // position
+	float    r, g, b, a; // color
+};
+
+struct TextureVertex
+{
+	uint16_t x, y; // position
+	float    u, v; // tex coords
+};
+
+// pre-transformed vertex of the SpriteBatch
+struct BatchVertex
+{
+	float x, y; // position
+	float u, v; // tex coords
+};
+
+class VertexBuffer
+{
+public:
+
+	struct VertexAttribute
+	{
+		size_t mComponentsCount;
+		size_t mStride; // in bytes
+		size_t mBeginStride; // in bytes
+        GLenum mType;
+	};
+
+	VertexBuffer() = delete;
+	explicit VertexBuffer(const std::vector<Vertex>& vertexData, const std::vector<uint16_t>& indexData,
+                          const BufferUsage vertexBufferUsage, const BufferUsage indexBufferUsage);
+
+	explicit VertexBuffer(const std::vector<ColorVertex>& vertexData, const std::vector<uint16_t>& indexData,
+						  const BufferUsage vertexBufferUsage, const BufferUsage indexBufferUsage);
+
+	explicit VertexBuffer(const std::vector<TextureVertex>& vertexData, const std::vector<uint16_t>& indexData,
+						  const BufferUsage vertexBufferUsage, const BufferUsage indexBufferUsage);
+
+	explicit VertexBuffer(const std::vector<BatchVertex>& vertexData, const std::vector<uint16_t>& indexData,
+						  const BufferUsage vertexBufferUsage, const BufferUsage indexBufferUsage);
+
+	VertexBuffer(const VertexBuffer&) = delete;
+	~VertexBuffer();
+
+	VertexBuffer& operator= (const VertexBuffer&) = delete;
+
+	void Bind() const;
+
+	void Unbind() const;
+
+	void Draw() const;
+
+	// draw indexCount indices starting from the firstIndex
+	void Draw(const size_t firstIndex, const size_t indexCount) const;
+
+    std::vector<byte_t>& LockVertexData();
+
+    // upload the whole vertex data
+    void UnlockVertexData(const size_t newVertexCount);
+
+    // upload only the changed span of the vertex data
+    // dirtyOffset, dirtySize - in bytes
+    void UnlockVertexData(const size_t newVertexCount, const size_t dirtyOffset, const size_t dirtySize);
+
+    std::vector<uint16_t>& LockIndexData();
+
+    // upload the whole index data
+    void UnlockIndexData();
+
+    // upload only the changed span of the index data
+    // dirtyOffset, dirtyCount - in indices
+    void UnlockIndexData(const size_t dirtyOffset, const size_t dirtyCount);
+
+    // streamed data is uploaded into a new storage every time (the dirty span is ignored),
+    // so the driver doesn't wait for the draws using the old data
+    void SetOrphaning(const bool orphaning)
+    {
+        mOrphaning = orphaning;
+    }
+
+    size_t GetVertexCount() const
+    {
+        return mVertexCount;
+    }
+
+    size_t GetIndexCount() const
+    {
+        return mIndexCount;
+    }
+
+    size_t GetAttributesCount() const
+    {
+        return mAttributesCount;
+    }
+
+    GLuint GetHandle() const
+    {
+        return mVertexBuffer;
+    }
+
+    GLuint GetIndexHandle() const
+    {
+        return mIndexBuffer;
+    }
+
+    const VertexAttribute& GetVertexAttribute(const size_t index) const
+    {
+        return mVertexAttributes[index];
+    }
+
+private:
+
+	void Init(const byte_t* vertexData, const size_t vertexDataSize, const std::vector<uint16_t>& indexData,
+              const BufferUsage vertexBufferUsage, const BufferUsage indexBufferUsage);
+
+    // the buffer must be bound to the target
+    // bufferSize - allocated storage size, updated on the reallocation
+    void UploadData(const GLenum target, const byte_t* data, const size_t dataSize, const size_t dirtyOffset,
+                    const size_t dirtySize, const GLenum usage, size_t& bufferSize);
+
+	typedef std::array<VertexAttribute, kMaxVertexAttributesCount> VertexAttributesArray;
+
+	union
+	{
+		struct
+		{
+			GLuint mVertexBuffer;
+			GLuint mIndexBuffer;
+		};
+		std::array<GLuint, 2> mBuffers;
+	};
+
+	size_t                mIndexCount;
+    size_t                mVertexCount;
+	size_t                mAttributesCount;
+    GLenum                mVertexBufferUsage;
+    GLenum                mIndexBufferUsage;
+    size_t                mVertexBufferSize; // in bytes
+    size_t                mIndexBufferSize; // in bytes
+    bool                  mOrphaning;
+    bool                  mVertexDataLocked;
+    bool                  mIndexDataLocked;
+    bool                  mEmpty;
+    std::vector<byte_t>   mVertexCache;
+    std::vector<uint16_t> mIndexCache;
+	VertexAttributesArray mVertexAttributes;
+};
+
+} // Pacman namespace
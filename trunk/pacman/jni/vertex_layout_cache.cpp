@@ -0,0 +1,263 @@
+#include "vertex_layout_cache.h"
+
+#include <EGL/egl.h>
+#include <array>
+#include <cstring>
+#include <unordered_map>
+
+#include "error.h"
+#include "gl_wrapper.h"
+#include "vertex_buffer.h"
+
+namespace Pacman {
+
+static const char* kVertexArrayExtension = "GL_OES_vertex_array_object";
+
+struct AttributeState
+{
+    bool    mEnabled;
+    GLuint  mBuffer; // buffer of the pointer (0 - the pointer is unknown)
+    GLint   mComponentsCount;
+    GLenum  mType;
+    GLsizei mStride;
+    size_t  mOffset;
+};
+
+typedef std::array<AttributeState, kMaxVertexAttributesCount> AttributeStatesArray;
+
+static VertexLayoutApi gApi = { glBindBuffer, glEnableVertexAttribArray, glDisableVertexAttribArray,
+                                glVertexAttribPointer, nullptr, nullptr, nullptr };
+
+static GLuint gArrayBuffer = 0;
+static GLuint gElementBuffer = 0; // of the default vertex array
+static GLuint gVertexArray = 0;
+static AttributeStatesArray gAttributes; // of the default vertex array
+static std::unordered_map<GLuint, GLuint> gVertexArrays; // vertex buffer -> vertex array object
+
+static FORCEINLINE void SetArrayBuffer(const GLuint buffer)
+{
+    if (gArrayBuffer != buffer)
+    {
+        GL::Count(GLCounter::BufferBinds);
+        gApi.mBindBuffer(GL_ARRAY_BUFFER, buffer);
+        gArrayBuffer = buffer;
+    }
+}
+
+static FORCEINLINE void SetVertexArray(const GLuint vertexArray)
+{
+    if (gVertexArray != vertexArray)
+    {
+        GL::Count(GLCounter::VertexArrayBinds);
+        gApi.mBindVertexArray(vertexArray);
+        gVertexArray = vertexArray;
+    }
+}
+
+static FORCEINLINE bool IsPointerEqual(const AttributeState& state, const GLuint buffer,
+                                       const VertexBuffer::VertexAttribute& attribute)
+{
+    return (state.mBuffer == buffer) &&
+           (state.mComponentsCount == static_cast<GLint>(attribute.mComponentsCount)) &&
+           (state.mType == attribute.mType) &&
+           (state.mStride == static_cast<GLsizei>(attribute.mStride)) &&
+           (state.mOffset == attribute.mBeginStride);
+}
+
+static void SetAttributePointer(const size_t index, const GLuint buffer, const VertexBuffer::VertexAttribute& attribute)
+{
+    SetArrayBuffer(buffer);
+    gApi.mVertexAttribPointer(index, attribute.mComponentsCount, attribute.mType, GL_FALSE,
+                              attribute.mStride, reinterpret_cast<GLvoid*>(attribute.mBeginStride));
+}
+
+static void ResetAttributes()
+{
+    for (AttributeState& state : gAttributes)
+    {
+        std::memset(&state, 0, sizeof(AttributeState));
+    }
+}
+
+// fill the layout of the just created vertex array object
+static void SetupVertexArray(const VertexBuffer& vertexBuffer)
+{
+    for (size_t i = 0; i < vertexBuffer.GetAttributesCount(); i++)
+    {
+        SetAttributePointer(i, vertexBuffer.GetHandle(), vertexBuffer.GetVertexAttribute(i));
+        gApi.mEnableVertexAttribArray(i);
+    }
+
+    GL::Count(GLCounter::BufferBinds);
+    gApi.mBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vertexBuffer.GetIndexHandle());
+}
+
+// send the difference between the tracked and the requested layout
+static void UpdateAttributes(const VertexBuffer& vertexBuffer)
+{
+    const GLuint buffer = vertexBuffer.GetHandle();
+    const size_t attributesCount = vertexBuffer.GetAttributesCount();
+
+    for (size_t i = 0; i < gAttributes.size(); i++)
+    {
+        AttributeState& state = gAttributes[i];
+        if (i >= attributesCount)
+        {
+            if (state.mEnabled)
+            {
+                gApi.mDisableVertexAttribArray(i);
+                state.mEnabled = false;
+            }
+
+            continue;
+        }
+
+        const VertexBuffer::VertexAttribute& attribute = vertexBuffer.GetVertexAttribute(i);
+        if (!IsPointerEqual(state, buffer, attribute))
+        {
+            SetAttributePointer(i, buffer, attribute);
+            state = { state.mEnabled, buffer, static_cast<GLint>(attribute.mComponentsCount), attribute.mType,
+                      static_cast<GLsizei>(attribute.mStride), attribute.mBeginStride };
+        }
+
+        if (!state.mEnabled)
+        {
+            gApi.mEnableVertexAttribArray(i);
+            state.mEnabled = true;
+        }
+    }
+
+    VertexLayoutCache::BindElementBuffer(vertexBuffer.GetIndexHandle());
+}
+
+//===========================================================================================================
+
+VertexLayoutApi VertexLayoutCache::MakeDefaultApi()
+{
+    VertexLayoutApi api = { glBindBuffer, glEnableVertexAttribArray, glDisableVertexAttribArray,
+                            glVertexAttribPointer, nullptr, nullptr, nullptr };
+
+    const char* extensions = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+    if ((extensions != nullptr) && (std::strstr(extensions, kVertexArrayExtension) != nullptr))
+    {
+        api.mGenVertexArrays = reinterpret_cast<decltype(api.mGenVertexArrays)>(eglGetProcAddress("glGenVertexArraysOES"));
+        api.mBindVertexArray = reinterpret_cast<decltype(api.mBindVertexArray)>(eglGetProcAddress("glBindVertexArrayOES"));
+        api.mDeleteVertexArrays = reinterpret_cast<decltype(api.mDeleteVertexArrays)>(eglGetProcAddress("glDeleteVertexArraysOES"));
+
+        // some drivers report the extension without the entry points
+        if ((api.mGenVertexArrays == nullptr) || (api.mBindVertexArray == nullptr) || (api.mDeleteVertexArrays == nullptr))
+        {
+            api.mGenVertexArrays = nullptr;
+            api.mBindVertexArray = nullptr;
+            api.mDeleteVertexArrays = nullptr;
+        }
+    }
+
+    return api;
+}
+
+void VertexLayoutCache::Init(const VertexLayoutApi& api)
+{
+    // vertex array objects of the previous context are already destroyed with it
+    gApi = api;
+    gArrayBuffer = 0;
+    gElementBuffer = 0;
+    gVertexArray = 0;
+    gVertexArrays.clear();
+    ResetAttributes();
+}
+
+bool VertexLayoutCache::HasVertexArrays()
+{
+    return gApi.mBindVertexArray != nullptr;
+}
+
+void VertexLayoutCache::Bind(const VertexBuffer& vertexBuffer)
+{
+    PACMAN_CHECK_ERROR(vertexBuffer.GetAttributesCount() <= kMaxVertexAttributesCount);
+
+    if (!HasVertexArrays())
+    {
+        UpdateAttributes(vertexBuffer);
+        return;
+    }
+
+    auto iter = gVertexArrays.find(vertexBuffer.GetHandle());
+    if (iter != gVertexArrays.end())
+    {
+        SetVertexArray(iter->second);
+        return;
+    }
+
+    GLuint vertexArray = 0;
+    gApi.mGenVertexArrays(1, &vertexArray);
+    PACMAN_CHECK_ERROR(vertexArray != 0);
+    SetVertexArray(vertexArray);
+    SetupVertexArray(vertexBuffer);
+    gVertexArrays.insert(std::make_pair(vertexBuffer.GetHandle(), vertexArray));
+}
+
+void VertexLayoutCache::Unbind()
+{
+    if (HasVertexArrays())
+    {
+        SetVertexArray(0);
+        return;
+    }
+
+    for (size_t i = 0; i < gAttributes.size(); i++)
+    {
+        if (gAttributes[i].mEnabled)
+        {
+            gApi.mDisableVertexAttribArray(i);
+            gAttributes[i].mEnabled = false;
+        }
+    }
+}
+
+void VertexLayoutCache::BindArrayBuffer(const GLuint buffer)
+{
+    SetArrayBuffer(buffer);
+}
+
+void VertexLayoutCache::BindElementBuffer(const GLuint buffer)
+{
+    // the element buffer binding is a part of the vertex array object state
+    if (HasVertexArrays())
+        SetVertexArray(0);
+
+    if (gElementBuffer != buffer)
+    {
+        GL::Count(GLCounter::BufferBinds);
+        gApi.mBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
+        gElementBuffer = buffer;
+    }
+}
+
+void VertexLayoutCache::OnBuffersDeleted(const GLuint vertexBuffer, const GLuint indexBuffer)
+{
+    // GL unbinds the deleted buffers, names can be reused by the new ones
+    if (gArrayBuffer == vertexBuffer)
+        gArrayBuffer = 0;
+
+    if (gElementBuffer == indexBuffer)
+        gElementBuffer = 0;
+
+    for (AttributeState& state : gAttributes)
+    {
+        if (state.mBuffer == vertexBuffer)
+            state.mBuffer = 0;
+    }
+
+    auto iter = gVertexArrays.find(vertexBuffer);
+    if (iter != gVertexArrays.end())
+    {
+        if (gVertexArray == iter->second)
+            SetVertexArray(0);
+
+        gApi.mDeleteVertexArrays(1, &iter->second);
+        gVertexArrays.erase(iter);
+    }
+}
+
+} // Pacman namespace
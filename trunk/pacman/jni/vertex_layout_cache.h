@@ -0,0 +1,52 @@
+#pragma once
+
+#include <GLES2/gl2.h>
+
+#include "base.h"
+#include "engine_forwdecl.h"
+
+namespace Pacman {
+
+// GL entry points used by the VertexLayoutCache (can be replaced by a recording stand-in)
+struct VertexLayoutApi
+{
+    void (GL_APIENTRYP mBindBuffer)(GLenum target, GLuint buffer);
+    void (GL_APIENTRYP mEnableVertexAttribArray)(GLuint index);
+    void (GL_APIENTRYP mDisableVertexAttribArray)(GLuint index);
+    void (GL_APIENTRYP mVertexAttribPointer)(GLuint index, GLint size, GLenum type, GLboolean normalized,
+                                             GLsizei stride, const GLvoid* pointer);
+
+    // OES_vertex_array_object, nullptr if the extension isn't supported
+    void (GL_APIENTRYP mGenVertexArrays)(GLsizei count, GLuint* arrays);
+    void (GL_APIENTRYP mBindVertexArray)(GLuint array);
+    void (GL_APIENTRYP mDeleteVertexArrays)(GLsizei count, const GLuint* arrays);
+};
+
+// tracks the vertex layout state of the GL context and sends only the changes to the driver
+// with OES_vertex_array_object every vertex buffer gets its own vertex array object,
+// otherwise the enabled attribute arrays and their pointers are compared with the requested ones
+// all vertex and index buffer bindings must go through the cache
+struct VertexLayoutCache
+{
+    // GL functions of the current context (vertex array objects are loaded if supported)
+    static VertexLayoutApi MakeDefaultApi();
+
+    // forget the tracked state, must be called for every new GL context
+    static void Init(const VertexLayoutApi& api);
+
+    static bool HasVertexArrays();
+
+    static void Bind(const VertexBuffer& vertexBuffer);
+
+    // reset the vertex layout to the default one
+    static void Unbind();
+
+    // bind the buffer for the data upload
+    static void BindArrayBuffer(const GLuint buffer);
+    static void BindElementBuffer(const GLuint buffer);
+
+    // must be called before the buffers deletion
+    static void OnBuffersDeleted(const GLuint vertexBuffer, const GLuint indexBuffer);
+};
+
+} // Pacman namespace
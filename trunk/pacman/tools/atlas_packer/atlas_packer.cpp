@@ -0,0 +1,292 @@
+// Packs the sprites images into the texture atlas pages and writes the spritesheet manifest
+// which is loaded by the AssetManager::LoadSpriteSheet.
+//
+// usage: atlas_packer <definition.json> <images dir> <output dir>
+//
+// definition format:
+// {
+//     "name":"spritesheet1",      - output name, pages are <name>_<page>[@Nx].png, manifests are <name>[@Nx].json
+//     "filtering":1,              - copied into the manifest
+//     "max_page_size":512,        - page size limit for the 1x multiplier (scaled by the multiplier)
+//     "padding":1,                - gap between the sprites in pixels (scaled by the multiplier)
+//     "multipliers":[1, 2, 3, 4],
+//     "list": [
+//         { "name":"cherry", "image":"cherry.png", "vs":"def_sprite_shader.vs", "fs":"def_texture_shader.fs", "alpha_blend":true },
+//         ...
+//     ]
+// }
+//
+// sprite images are searched as <image>@Nx.png, the 1x multiplier also accepts the plain <image> name
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+#include "json/json.h"
+#include "png_image.h"
+#include "skyline_packer.h"
+
+namespace Pacman {
+namespace Tools {
+
+struct SpriteDefinition
+{
+    std::string mName;
+    std::string mImage;
+    std::string mVertexShader;
+    std::string mFragmentShader;
+    bool        mAlphaBlend;
+};
+
+struct PackedSprite
+{
+    const SpriteDefinition* mDefinition;
+    Image                   mImage;
+    size_t                  mPage;
+    PackRect                mRect;
+};
+
+struct Page
+{
+    SkylinePacker mPacker;
+    Image         mImage;
+};
+
+static size_t NextPOT(size_t value)
+{
+    size_t result = 1;
+    while (result < value)
+        result <<= 1;
+
+    return result;
+}
+
+static std::string ApplyMultiplier(const std::string& name, const size_t multiplier)
+{
+    const size_t dotPos = name.find_last_of('.');
+    if (dotPos == std::string::npos)
+        throw std::runtime_error("file name without extension: " + name);
+
+    std::ostringstream result;
+    result << name.substr(0, dotPos) << "@" << multiplier << "x." << name.substr(dotPos + 1);
+    return result.str();
+}
+
+static std::string MakeOutputName(const std::string& name, const size_t multiplier)
+{
+    // 1x assets are stored without the suffix
+    return (multiplier == 1) ? name : ApplyMultiplier(name, multiplier);
+}
+
+static std::string ReadTextFile(const std::string& path)
+{
+    std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+    if (!file)
+        throw std::runtime_error("can't open " + path);
+
+    std::ostringstream data;
+    data << file.rdbuf();
+    return data.str();
+}
+
+static Image LoadSpriteImage(const std::string& imagesDir, const std::string& name, const size_t multiplier)
+{
+    Image image;
+    if (LoadImage(imagesDir + "/" + ApplyMultiplier(name, multiplier), image))
+        return image;
+
+    if ((multiplier == 1) && LoadImage(imagesDir + "/" + name, image))
+        return image;
+
+    throw std::runtime_error("can't load the image " + name + " for the multiplier " + std::to_string(multiplier));
+}
+
+static void CopyImage(const Image& source, Image& destination, const size_t x, const size_t y)
+{
+    const size_t rowSize = source.mWidth * kPixelSize;
+    for (size_t row = 0; row < source.mHeight; row++)
+    {
+        const uint8_t* src = &source.mPixels[row * rowSize];
+        uint8_t* dst = &destination.mPixels[((y + row) * destination.mWidth + x) * kPixelSize];
+        std::memcpy(dst, src, rowSize);
+    }
+}
+
+static void PackSprites(std::vector<PackedSprite>& sprites, std::vector<Page>& pages, const size_t pageSize, const size_t padding)
+{
+    // the tallest sprites first, it keeps the skyline flat
+    std::vector<PackedSprite*> order;
+    for (PackedSprite& sprite : sprites)
+        order.push_back(&sprite);
+
+    std::stable_sort(order.begin(), order.end(), [](const PackedSprite* first, const PackedSprite* second)
+    {
+        return first->mImage.mHeight > second->mImage.mHeight;
+    });
+
+    for (PackedSprite* sprite : order)
+    {
+        const size_t width = sprite->mImage.mWidth + padding;
+        const size_t height = sprite->mImage.mHeight + padding;
+        if ((width > pageSize) || (height > pageSize))
+            throw std::runtime_error("sprite " + sprite->mDefinition->mName + " is bigger than the page");
+
+        bool packed = false;
+        for (size_t i = 0; (i < pages.size()) && !packed; i++)
+        {
+            packed = pages[i].mPacker.Insert(width, height, sprite->mRect);
+            sprite->mPage = i;
+        }
+
+        if (!packed)
+        {
+            pages.push_back({ SkylinePacker(pageSize, pageSize), Image() });
+            sprite->mPage = pages.size() - 1;
+            pages.back().mPacker.Insert(width, height, sprite->mRect);
+        }
+    }
+}
+
+static Json::Value PackMultiplier(const Json::Value& definition, const std::vector<SpriteDefinition>& spriteDefinitions,
+                                  const std::string& imagesDir, const std::string& outputDir, const size_t multiplier)
+{
+    const std::string name = definition["name"].asString();
+    const size_t pageSize = definition["max_page_size"].asUInt() * multiplier;
+    const size_t padding = definition.get("padding", 1).asUInt() * multiplier;
+
+    std::vector<PackedSprite> sprites;
+    for (const SpriteDefinition& spriteDefinition : spriteDefinitions)
+    {
+        const PackedSprite sprite = { &spriteDefinition, LoadSpriteImage(imagesDir, spriteDefinition.mImage, multiplier), 0, PackRect() };
+        sprites.push_back(sprite);
+    }
+
+    std::vector<Page> pages;
+    PackSprites(sprites, pages, pageSize, padding);
+
+    // shrink the pages to the power of two sizes
+    for (Page& page : pages)
+    {
+        page.mImage.mWidth = NextPOT(page.mPacker.GetUsedWidth());
+        page.mImage.mHeight = NextPOT(page.mPacker.GetUsedHeight());
+        page.mImage.mPixels.assign(page.mImage.mWidth * page.mImage.mHeight * kPixelSize, 0);
+    }
+
+    Json::Value manifest(Json::objectValue);
+    manifest["filtering"] = definition["filtering"];
+    manifest["pages"] = Json::Value(Json::arrayValue);
+    manifest["list"] = Json::Value(Json::arrayValue);
+
+    for (size_t i = 0; i < pages.size(); i++)
+    {
+        // pages are referenced without the multiplier, the AssetManager applies it
+        std::ostringstream pageName;
+        pageName << name << "_" << i << ".png";
+        manifest["pages"].append(pageName.str());
+    }
+
+    for (const PackedSprite& sprite : sprites)
+    {
+        const Page& page = pages[sprite.mPage];
+        CopyImage(sprite.mImage, pages[sprite.mPage].mImage, sprite.mRect.mX, sprite.mRect.mY);
+
+        const float pageWidth = static_cast<float>(page.mImage.mWidth);
+        const float pageHeight = static_cast<float>(page.mImage.mHeight);
+
+        Json::Value entry(Json::objectValue);
+        entry["name"] = sprite.mDefinition->mName;
+        entry["vs"] = sprite.mDefinition->mVertexShader;
+        entry["fs"] = sprite.mDefinition->mFragmentShader;
+        entry["alpha_blend"] = sprite.mDefinition->mAlphaBlend;
+        entry["page"] = static_cast<Json::UInt>(sprite.mPage);
+        entry["x"] = sprite.mRect.mX / pageWidth;
+        entry["y"] = sprite.mRect.mY / pageHeight;
+        entry["width"] = sprite.mImage.mWidth / pageWidth;
+        entry["height"] = sprite.mImage.mHeight / pageHeight;
+        manifest["list"].append(entry);
+    }
+
+    for (size_t i = 0; i < pages.size(); i++)
+    {
+        const std::string pageName = manifest["pages"][static_cast<Json::UInt>(i)].asString();
+        SaveImage(outputDir + "/" + MakeOutputName(pageName, multiplier), pages[i].mImage);
+    }
+
+    std::cout << name << " @" << multiplier << "x: " << sprites.size() << " sprites, " << pages.size() << " page(s)" << std::endl;
+    return manifest;
+}
+
+static void Run(const std::string& definitionPath, const std::string& imagesDir, const std::string& outputDir)
+{
+    Json::Value definition;
+    Json::Reader reader;
+    if (!reader.parse(ReadTextFile(definitionPath), definition, false) || !definition.isObject())
+        throw std::runtime_error("can't parse " + definitionPath);
+
+    std::vector<SpriteDefinition> spriteDefinitions;
+    const Json::Value& list = definition["list"];
+    for (Json::UInt i = 0; i < list.size(); i++)
+    {
+        const Json::Value& sprite = list[i];
+        const SpriteDefinition spriteDefinition =
+        {
+            sprite["name"].asString(),
+            sprite["image"].asString(),
+            sprite["vs"].asString(),
+            sprite["fs"].asString(),
+            sprite["alpha_blend"].asBool()
+        };
+
+        spriteDefinitions.push_back(spriteDefinition);
+    }
+
+    if (spriteDefinitions.empty() || definition["name"].asString().empty())
+        throw std::runtime_error("empty definition " + definitionPath);
+
+    const std::string name = definition["name"].asString();
+    const Json::Value& multipliers = definition["multipliers"];
+    for (Json::UInt i = 0; i < multipliers.size(); i++)
+    {
+        const size_t multiplier = multipliers[i].asUInt();
+        const Json::Value manifest = PackMultiplier(definition, spriteDefinitions, imagesDir, outputDir, multiplier);
+
+        const std::string manifestPath = outputDir + "/" + MakeOutputName(name + ".json", multiplier);
+        std::ofstream file(manifestPath.c_str(), std::ios::out | std::ios::binary);
+        if (!file)
+            throw std::runtime_error("can't write " + manifestPath);
+
+        Json::StyledWriter writer;
+        file << writer.write(manifest);
+    }
+}
+
+} // Tools namespace
+} // Pacman namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != 4)
+    {
+        std::cerr << "usage: atlas_packer <definition.json> <images dir> <output dir>" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        Pacman::Tools::Run(argv[1], argv[2], argv[3]);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include "skyline_packer.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace Pacman {
+namespace Tools {
+
+SkylinePacker::SkylinePacker(const size_t width, const size_t height)
+             : mWidth(width),
+               mHeight(height),
+               mUsedWidth(0),
+               mUsedHeight(0),
+               mSkyline()
+{
+    const Segment segment = { 0, 0, width };
+    mSkyline.push_back(segment);
+}
+
+bool SkylinePacker::Insert(const size_t width, const size_t height, PackRect& result)
+{
+    size_t bestIndex = mSkyline.size();
+    size_t bestTop = std::numeric_limits<size_t>::max();
+    size_t bestWidth = std::numeric_limits<size_t>::max();
+
+    for (size_t i = 0; i < mSkyline.size(); i++)
+    {
+        size_t y = 0;
+        if (!Fit(i, width, height, y))
+            continue;
+
+        // the lowest top edge wins, the narrowest segment breaks ties
+        const size_t top = y + height;
+        if ((top < bestTop) || ((top == bestTop) && (mSkyline[i].mWidth < bestWidth)))
+        {
+            bestIndex = i;
+            bestTop = top;
+            bestWidth = mSkyline[i].mWidth;
+            result = { mSkyline[i].mX, y, width, height };
+        }
+    }
+
+    if (bestIndex == mSkyline.size())
+        return false;
+
+    AddSkylineLevel(bestIndex, result);
+    mUsedWidth = std::max(mUsedWidth, result.mX + result.mWidth);
+    mUsedHeight = std::max(mUsedHeight, result.mY + result.mHeight);
+    return true;
+}
+
+bool SkylinePacker::Fit(const size_t segmentIndex, const size_t width, const size_t height, size_t& y) const
+{
+    const size_t x = mSkyline[segmentIndex].mX;
+    if (x + width > mWidth)
+        return false;
+
+    // the rectangle lies on the highest segment under it
+    size_t widthLeft = width;
+    size_t i = segmentIndex;
+    y = mSkyline[segmentIndex].mY;
+    while (widthLeft > 0)
+    {
+        y = std::max(y, mSkyline[i].mY);
+        if (y + height > mHeight)
+            return false;
+
+        widthLeft -= std::min(widthLeft, mSkyline[i].mWidth);
+        i++;
+    }
+
+    return true;
+}
+
+void SkylinePacker::AddSkylineLevel(const size_t segmentIndex, const PackRect& rect)
+{
+    const Segment segment = { rect.mX, rect.mY + rect.mHeight, rect.mWidth };
+    mSkyline.insert(mSkyline.begin() + segmentIndex, segment);
+
+    // shrink or remove the segments covered by the new one
+    for (size_t i = segmentIndex + 1; i < mSkyline.size(); i++)
+    {
+        const Segment& previous = mSkyline[i - 1];
+        Segment& current = mSkyline[i];
+
+        const size_t previousEnd = previous.mX + previous.mWidth;
+        if (current.mX >= previousEnd)
+            break;
+
+        const size_t shrink = previousEnd - current.mX;
+        if (current.mWidth > shrink)
+        {
+            current.mX += shrink;
+            current.mWidth -= shrink;
+            break;
+        }
+
+        mSkyline.erase(mSkyline.begin() + i);
+        i--;
+    }
+
+    MergeSkylines();
+}
+
+void SkylinePacker::MergeSkylines()
+{
+    for (size_t i = 0; i + 1 < mSkyline.size(); i++)
+    {
+        if (mSkyline[i].mY == mSkyline[i + 1].mY)
+        {
+            mSkyline[i].mWidth += mSkyline[i + 1].mWidth;
+            mSkyline.erase(mSkyline.begin() + i + 1);
+            i--;
+        }
+    }
+}
+
+} // Tools namespace
+} // Pacman namespace
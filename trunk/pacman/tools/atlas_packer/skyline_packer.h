@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace Pacman {
+namespace Tools {
+
+struct PackRect
+{
+    size_t mX, mY;
+    size_t mWidth, mHeight;
+};
+
+// skyline bottom-left rectangles packer
+// the skyline is a list of horizontal segments describing the top edge of the already packed rectangles,
+// a new rectangle is placed on the segment where its top edge ends up the lowest
+class SkylinePacker
+{
+public:
+
+    SkylinePacker() = delete;
+    SkylinePacker(const size_t width, const size_t height);
+    SkylinePacker(const SkylinePacker&) = default;
+    ~SkylinePacker() = default;
+
+    SkylinePacker& operator= (const SkylinePacker&) = default;
+
+    // returns false if the rectangle doesn't fit
+    bool Insert(const size_t width, const size_t height, PackRect& result);
+
+    // bounding box of the packed rectangles
+    size_t GetUsedWidth() const
+    {
+        return mUsedWidth;
+    }
+
+    size_t GetUsedHeight() const
+    {
+        return mUsedHeight;
+    }
+
+private:
+
+    struct Segment
+    {
+        size_t mX, mY;
+        size_t mWidth;
+    };
+
+    // returns false if the rectangle doesn't fit at the segment
+    bool Fit(const size_t segmentIndex, const size_t width, const size_t height, size_t& y) const;
+
+    void AddSkylineLevel(const size_t segmentIndex, const PackRect& rect);
+
+    void MergeSkylines();
+
+    size_t               mWidth;
+    size_t               mHeight;
+    size_t               mUsedWidth;
+    size_t               mUsedHeight;
+    std::vector<Segment> mSkyline;
+};
+
+} // Tools namespace
+} // Pacman namespace
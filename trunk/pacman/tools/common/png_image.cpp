@@ -0,0 +1,44 @@
+#include "png_image.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <png.h>
+
+namespace Pacman {
+namespace Tools {
+
+bool LoadImage(const std::string& path, Image& image)
+{
+    png_image png;
+    std::memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+
+    if (!png_image_begin_read_from_file(&png, path.c_str()))
+        return false;
+
+    png.format = PNG_FORMAT_RGBA;
+    image.mWidth = png.width;
+    image.mHeight = png.height;
+    image.mPixels.resize(PNG_IMAGE_SIZE(png));
+
+    if (!png_image_finish_read(&png, nullptr, &image.mPixels.front(), 0, nullptr))
+        throw std::runtime_error(path + ": " + png.message);
+
+    return true;
+}
+
+void SaveImage(const std::string& path, const Image& image)
+{
+    png_image png;
+    std::memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    png.width = image.mWidth;
+    png.height = image.mHeight;
+    png.format = PNG_FORMAT_RGBA;
+
+    if (!png_image_write_to_file(&png, path.c_str(), 0, &image.mPixels.front(), 0, nullptr))
+        throw std::runtime_error(path + ": " + png.message);
+}
+
+} // Tools namespace
+} // Pacman namespace
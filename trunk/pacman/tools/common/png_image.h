@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Pacman {
+namespace Tools {
+
+static const size_t kPixelSize = 4; // RGBA
+
+// RGBA8 image, rows from the top one
+struct Image
+{
+    size_t               mWidth;
+    size_t               mHeight;
+    std::vector<uint8_t> mPixels;
+};
+
+// returns false if the file can't be opened
+bool LoadImage(const std::string& path, Image& image);
+
+void SaveImage(const std::string& path, const Image& image);
+
+} // Tools namespace
+} // Pacman namespace
@@ -0,0 +1,188 @@
+#include "fields_benchmark.h"
+
+#include <cstdio>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+
+#include "game/map.h"
+#include "game/common.h"
+#include "game/distance_field.h"
+
+namespace Pacman {
+namespace Tools {
+
+static const size_t   kMinMazeSize = 32;
+static const size_t   kMaxMazeSize = 1024;
+static const Size     kMazeCellSize = 2;          // the map texture is generated, keep it small
+static const size_t   kBuildCellsBudget = 1 << 24; // visited cells of all builds for the size
+static const size_t   kDecisionsCount = 1 << 20;
+static const uint32_t kLoopsPercent = 10;          // removed walls of the perfect maze, the ghosts need the choice
+
+struct Decision
+{
+    CellIndex     mCell;
+    DirectionMask mDirections;
+};
+
+typedef std::chrono::steady_clock Clock;
+
+// the selected directions are summed up here, so the decisions aren't optimized out
+static volatile size_t gChecksum = 0;
+
+static double GetSeconds(const Clock::time_point& start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// the perfect maze on the odd cells (randomized depth-first search) with the part of the walls removed,
+// the tunnel links the borders of the first row
+static std::vector<MapCellType> GenerateMaze(const size_t size, std::minstd_rand& random)
+{
+    std::vector<MapCellType> cells(size * size, MapCellType::Wall);
+    const auto at = [&cells, size](const size_t row, const size_t column) -> MapCellType&
+    {
+        return cells[(row * size) + column];
+    };
+
+    // the odd cells inside the border
+    const size_t last = ((size - 2) % 2 == 0) ? (size - 3) : (size - 2);
+    static const int kSteps[4][2] = { { 0, -2 }, { 0, 2 }, { -2, 0 }, { 2, 0 } };
+
+    std::vector<std::pair<size_t, size_t>> stack;
+    stack.push_back(std::make_pair(1, 1));
+    at(1, 1) = MapCellType::Empty;
+    while (!stack.empty())
+    {
+        const size_t row = stack.back().first;
+        const size_t column = stack.back().second;
+
+        size_t candidates[4];
+        size_t candidatesCount = 0;
+        for (size_t i = 0; i < 4; i++)
+        {
+            const long nextRow = static_cast<long>(row) + kSteps[i][0];
+            const long nextColumn = static_cast<long>(column) + kSteps[i][1];
+            if ((nextRow >= 1) && (nextColumn >= 1) && (nextRow <= static_cast<long>(last)) && (nextColumn <= static_cast<long>(last)) &&
+                (at(nextRow, nextColumn) == MapCellType::Wall))
+            {
+                candidates[candidatesCount++] = i;
+            }
+        }
+
+        if (candidatesCount == 0)
+        {
+            stack.pop_back();
+            continue;
+        }
+
+        const size_t step = candidates[random() % candidatesCount];
+        const size_t nextRow = row + kSteps[step][0];
+        const size_t nextColumn = column + kSteps[step][1];
+        at((row + nextRow) / 2, (column + nextColumn) / 2) = MapCellType::Empty;
+        at(nextRow, nextColumn) = MapCellType::Empty;
+        stack.push_back(std::make_pair(nextRow, nextColumn));
+    }
+
+    // the walls between two corridors become the loops
+    for (size_t i = 1; i <= last; i++)
+    {
+        for (size_t j = 1; j <= last; j++)
+        {
+            const bool horizontal = (i % 2 == 1) && (j % 2 == 0);
+            const bool vertical = (i % 2 == 0) && (j % 2 == 1);
+            if ((horizontal || vertical) && (at(i, j) == MapCellType::Wall) && ((random() % 100) < kLoopsPercent))
+                at(i, j) = MapCellType::Empty;
+        }
+    }
+
+    for (size_t j = 0; j < size; j++)
+    {
+        if ((j == 0) || (j > last))
+            at(1, j) = MapCellType::Empty;
+    }
+
+    return cells;
+}
+
+static void BenchmarkSize(const size_t size, std::minstd_rand& random)
+{
+    const std::vector<MapCellType> cells = GenerateMaze(size, random);
+    const CellIndex::value_t rowsCount = static_cast<CellIndex::value_t>(size);
+    const Size viewportSize = static_cast<Size>(size) * kMazeCellSize;
+    const Map map(kMazeCellSize, rowsCount, viewportSize, viewportSize, CellIndex(1, 0),
+                  CellIndex(1, static_cast<CellIndex::value_t>(size - 1)), cells);
+
+    std::vector<CellIndex> emptyCells;
+    for (CellIndex::value_t i = 0; i < rowsCount; i++)
+    {
+        for (CellIndex::value_t j = 0; j < rowsCount; j++)
+        {
+            if (map.GetCell(i, j) == MapCellType::Empty)
+                emptyCells.push_back(CellIndex(i, j));
+        }
+    }
+
+    // the field is rebuilt when pacman changes the cell, every build is the whole search
+    DistanceField field(map);
+    const size_t buildsCount = std::max<size_t>(kBuildCellsBudget / emptyCells.size(), 4);
+    const Clock::time_point buildStart = Clock::now();
+    for (size_t i = 0; i < buildsCount; i++)
+        field.Build(emptyCells[random() % emptyCells.size()]);
+    const double buildSeconds = GetSeconds(buildStart);
+
+    // the decisions at the cells with the choice, the way back is excluded as the ghosts do
+    std::vector<Decision> decisions;
+    decisions.reserve(kDecisionsCount);
+    while (decisions.size() < kDecisionsCount)
+    {
+        const CellIndex cell = emptyCells[random() % emptyCells.size()];
+        const DirectionMask directions = map.GetPassableDirections(cell, true);
+        if (GetDirectionsCount(directions) < 3)
+            continue;
+
+        const MoveDirection backDirection = kMoveDirections[random() % 4];
+        decisions.push_back({ cell, static_cast<DirectionMask>(directions & ~GetDirectionBit(backDirection)) });
+    }
+
+    const CellIndex target = field.GetTarget();
+    size_t checksum = 0;
+    const Clock::time_point straightStart = Clock::now();
+    for (const Decision& decision : decisions)
+        checksum += EnumCast(SelectNearestDirection(map, decision.mCell, target, decision.mDirections));
+    const double straightSeconds = GetSeconds(straightStart);
+
+    const Clock::time_point fieldStart = Clock::now();
+    for (const Decision& decision : decisions)
+        checksum += EnumCast(field.SelectDirection(decision.mCell, decision.mDirections));
+    const double fieldSeconds = GetSeconds(fieldStart);
+    gChecksum = gChecksum + checksum;
+
+    size_t differentCount = 0;
+    for (const Decision& decision : decisions)
+    {
+        if (SelectNearestDirection(map, decision.mCell, target, decision.mDirections) != field.SelectDirection(decision.mCell, decision.mDirections))
+            differentCount++;
+    }
+
+    std::printf("%4ux%-4u %7u cells | update %10.1f us | decision: straight %6.1f ns, field %6.1f ns | different %5.1f%%\n",
+                static_cast<unsigned>(size), static_cast<unsigned>(size), static_cast<unsigned>(emptyCells.size()),
+                (buildSeconds * 1e6) / buildsCount,
+                (straightSeconds * 1e9) / decisions.size(), (fieldSeconds * 1e9) / decisions.size(),
+                (100.0 * differentCount) / decisions.size());
+}
+
+void RunFieldsBenchmark(const size_t maxSize, const uint32_t seed)
+{
+    if ((maxSize < kMinMazeSize) || (maxSize > kMaxMazeSize))
+        throw std::runtime_error("the benchmark maze size should be in [32, 1024]");
+
+    std::minstd_rand random(seed);
+    for (size_t size = kMinMazeSize; size <= maxSize; size *= 2)
+        BenchmarkSize(size, random);
+}
+
+} // Tools namespace
+} // Pacman namespace
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Pacman {
+namespace Tools {
+
+// compares the cost of the ghost direction decision by the straight line distance and by the distance field,
+// and the cost of the field update, on the generated mazes from 32x32 up to maxSize x maxSize
+// the engine should be started (the map loads its shaders)
+// "different" is the part of the decisions where the straight line doesn't lead along the shortest path
+void RunFieldsBenchmark(const size_t maxSize, const uint32_t seed);
+
+} // Tools namespace
+} // Pacman namespace
@@ -0,0 +1,342 @@
+#include "game_tests.h"
+
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <stdexcept>
+
+#include "game/game.h"
+#include "game/map.h"
+#include "game/common.h"
+#include "game/nav_graph.h"
+#include "game/distance_field.h"
+
+namespace Pacman {
+namespace Tools {
+
+static const uint32_t kUnreachable = std::numeric_limits<uint32_t>::max();
+
+static size_t gFailuresCount = 0;
+
+static void Expect(const char* test, const char* value, const size_t actual, const size_t expected)
+{
+    if (actual == expected)
+        return;
+
+    std::printf("FAILED %s: %s is %u, expected %u\n", test, value, static_cast<unsigned>(actual), static_cast<unsigned>(expected));
+    gFailuresCount++;
+}
+
+static size_t GetCellOffset(const Map& map, const CellIndex& cell)
+{
+    return (GetRow(cell) * map.GetColumnsCount()) + GetColumn(cell);
+}
+
+// the path lengths from the cell to every cell of the map by the actors moves (the door is passable from the bottom,
+// the tunnel exits are linked), kUnreachable if the cell can't be reached
+static std::vector<uint32_t> FindDistances(const Map& map, const CellIndex& from)
+{
+    std::vector<uint32_t> distances(static_cast<size_t>(map.GetRowsCount()) * map.GetColumnsCount(), kUnreachable);
+    std::vector<CellIndex> queue;
+    distances[GetCellOffset(map, from)] = 0;
+    queue.push_back(from);
+
+    for (size_t head = 0; head < queue.size(); head++)
+    {
+        const CellIndex cell = queue[head];
+        const uint32_t distance = distances[GetCellOffset(map, cell)] + 1;
+        const auto visit = [&map, &distances, &queue, distance](const CellIndex& next)
+        {
+            if (distances[GetCellOffset(map, next)] == kUnreachable)
+            {
+                distances[GetCellOffset(map, next)] = distance;
+                queue.push_back(next);
+            }
+        };
+
+        const DirectionMask directions = map.GetPassableDirections(cell, true);
+        for (const MoveDirection direction : kMoveDirections)
+        {
+            if ((directions & GetDirectionBit(direction)) != 0)
+                visit(GetNext(cell, direction));
+        }
+
+        if (cell == map.GetLeftTunnelExit())
+            visit(map.GetRightTunnelExit());
+        else if (cell == map.GetRightTunnelExit())
+            visit(map.GetLeftTunnelExit());
+    }
+
+    return distances;
+}
+
+// the move target of every cell and direction is the cell where the straight walk meets the junction
+// or the blocked way (the corner or the dead end)
+static void TestMoveTargets()
+{
+    const char* test = "NavGraph::GetMoveTarget";
+    const Map& map = GetGame().GetMap();
+    const NavGraph& navGraph = GetGame().GetNavGraph();
+
+    size_t wrongTargetsCount = 0;
+    size_t junctionStopsCount = 0;
+    size_t cornerStopsCount = 0;
+    for (CellIndex::value_t i = 0; i < map.GetRowsCount(); i++)
+    {
+        for (CellIndex::value_t j = 0; j < map.GetColumnsCount(); j++)
+        {
+            const CellIndex cell(i, j);
+            if (map.GetCell(cell) != MapCellType::Empty)
+                continue;
+
+            for (const MoveDirection direction : kMoveDirections)
+            {
+                const DirectionMask directionBit = GetDirectionBit(direction);
+                CellIndex expectedTarget = cell;
+                if ((map.GetPassableDirections(cell, false) & directionBit) != 0)
+                {
+                    do
+                    {
+                        expectedTarget = GetNext(expectedTarget, direction);
+                    }
+                    while (!map.IsJunction(expectedTarget) && ((map.GetPassableDirections(expectedTarget, false) & directionBit) != 0));
+                }
+
+                const CellIndex target = navGraph.GetMoveTarget(cell, direction);
+                if (target != expectedTarget)
+                {
+                    wrongTargetsCount++;
+                    continue;
+                }
+
+                // the way turns at the corner
+                const DirectionMask turnDirections = map.GetPassableDirections(target, false) & ~(directionBit | GetDirectionBit(GetBackDirection(direction)));
+                if ((target != cell) && map.IsJunction(target))
+                    junctionStopsCount++;
+                else if ((target != cell) && (turnDirections != 0))
+                    cornerStopsCount++;
+            }
+        }
+    }
+
+    Expect(test, "wrong targets count", wrongTargetsCount, 0);
+    Expect(test, "has the junction stops", (junctionStopsCount > 0) ? 1 : 0, 1);
+    Expect(test, "has the corner stops", (cornerStopsCount > 0) ? 1 : 0, 1);
+}
+
+// the door is passed from the bottom only, the node above the door hasn't the way down
+static void TestDoorEdges()
+{
+    const char* test = "NavGraph door";
+    const Map& map = GetGame().GetMap();
+    const NavGraph& navGraph = GetGame().GetNavGraph();
+
+    size_t doorsCount = 0;
+    for (CellIndex::value_t i = 1; i < map.GetRowsCount(); i++)
+    {
+        for (CellIndex::value_t j = 0; j < map.GetColumnsCount(); j++)
+        {
+            const CellIndex door(i, j);
+            if (map.GetCell(door) != MapCellType::Door)
+                continue;
+
+            doorsCount++;
+            const NodeIndex aboveNode = navGraph.GetNodeIndex(CellIndex(i - 1, j));
+            Expect(test, "the node above the door exists", (aboveNode != kInvalidNode) ? 1 : 0, 1);
+            if (aboveNode == kInvalidNode)
+                continue;
+
+            size_t downEdgesCount = 0;
+            size_t doorEdgesCount = 0;
+            size_t wrongDoorEdgesCount = 0;
+            for (size_t edgeIndex = 0; edgeIndex < navGraph.GetEdgesCount(); edgeIndex++)
+            {
+                const NavEdge& edge = navGraph.GetEdge(static_cast<EdgeIndex>(edgeIndex));
+                if ((edge.mFrom == aboveNode) && (edge.mStartDirection == MoveDirection::Down))
+                    downEdgesCount++;
+
+                const CellIndex* cells = navGraph.GetEdgeCells(edge);
+                for (uint32_t k = 0; k < edge.mCellsCount; k++)
+                {
+                    if (cells[k] != door)
+                        continue;
+
+                    doorEdgesCount++;
+                    if ((edge.mTo != aboveNode) || (edge.mEndDirection != MoveDirection::Up))
+                        wrongDoorEdgesCount++;
+                }
+            }
+
+            Expect(test, "edges down from the node above the door", downEdgesCount, 0);
+            Expect(test, "has the edges through the door", (doorEdgesCount > 0) ? 1 : 0, 1);
+            Expect(test, "edges through the door not up to the node above it", wrongDoorEdgesCount, 0);
+        }
+    }
+
+    Expect(test, "has the door", (doorsCount > 0) ? 1 : 0, 1);
+}
+
+// the tunnel exits are linked by the single step edges both ways
+static void TestTunnelEdges()
+{
+    const char* test = "NavGraph tunnel";
+    const Map& map = GetGame().GetMap();
+    const NavGraph& navGraph = GetGame().GetNavGraph();
+
+    const NodeIndex leftNode = navGraph.GetNodeIndex(map.GetLeftTunnelExit());
+    const NodeIndex rightNode = navGraph.GetNodeIndex(map.GetRightTunnelExit());
+    Expect(test, "the left exit node exists", (leftNode != kInvalidNode) ? 1 : 0, 1);
+    Expect(test, "the right exit node exists", (rightNode != kInvalidNode) ? 1 : 0, 1);
+    if ((leftNode == kInvalidNode) || (rightNode == kInvalidNode))
+        return;
+
+    size_t leftEdgesCount = 0;
+    size_t rightEdgesCount = 0;
+    size_t tunnelEdgesCount = 0;
+    for (size_t edgeIndex = 0; edgeIndex < navGraph.GetEdgesCount(); edgeIndex++)
+    {
+        const NavEdge& edge = navGraph.GetEdge(static_cast<EdgeIndex>(edgeIndex));
+        if (!edge.mIsTunnel)
+            continue;
+
+        tunnelEdgesCount++;
+        Expect(test, "tunnel edge length", edge.mLength, 1);
+        if ((edge.mFrom == leftNode) && (edge.mTo == rightNode) && (edge.mStartDirection == MoveDirection::Left))
+            leftEdgesCount++;
+        else if ((edge.mFrom == rightNode) && (edge.mTo == leftNode) && (edge.mStartDirection == MoveDirection::Right))
+            rightEdgesCount++;
+    }
+
+    Expect(test, "tunnel edges count", tunnelEdgesCount, 2);
+    Expect(test, "edges from the left exit to the right one", leftEdgesCount, 1);
+    Expect(test, "edges from the right exit to the left one", rightEdgesCount, 1);
+    Expect(test, "FindPath from the left exit to the right one", navGraph.FindPath(leftNode, rightNode, nullptr), 1);
+    Expect(test, "FindPath from the right exit to the left one", navGraph.FindPath(rightNode, leftNode, nullptr), 1);
+}
+
+// the path of every nodes pair is the shortest one of the cells walk, its edges are chained from the start node to the end one
+static void TestFindPath()
+{
+    const char* test = "NavGraph::FindPath";
+    const Map& map = GetGame().GetMap();
+    const NavGraph& navGraph = GetGame().GetNavGraph();
+
+    size_t wrongDistancesCount = 0;
+    size_t wrongPathsCount = 0;
+    size_t reachedPairsCount = 0;
+    std::vector<EdgeIndex> path;
+    for (size_t from = 0; from < navGraph.GetNodesCount(); from++)
+    {
+        const std::vector<uint32_t> distances = FindDistances(map, navGraph.GetNode(static_cast<NodeIndex>(from)).mCell);
+        for (size_t to = 0; to < navGraph.GetNodesCount(); to++)
+        {
+            const uint32_t distance = navGraph.FindPath(static_cast<NodeIndex>(from), static_cast<NodeIndex>(to), &path);
+            const uint32_t expectedDistance = distances[GetCellOffset(map, navGraph.GetNode(static_cast<NodeIndex>(to)).mCell)];
+            if (distance != ((expectedDistance == kUnreachable) ? kInfiniteDistance : expectedDistance))
+            {
+                wrongDistancesCount++;
+                continue;
+            }
+
+            if (distance == kInfiniteDistance)
+                continue;
+
+            reachedPairsCount++;
+            uint32_t pathLength = 0;
+            size_t node = from;
+            for (const EdgeIndex edgeIndex : path)
+            {
+                const NavEdge& edge = navGraph.GetEdge(edgeIndex);
+                if (edge.mFrom != node)
+                    break;
+
+                pathLength += edge.mLength;
+                node = edge.mTo;
+            }
+
+            if ((node != to) || (pathLength != distance))
+                wrongPathsCount++;
+        }
+    }
+
+    Expect(test, "wrong distances count", wrongDistancesCount, 0);
+    Expect(test, "wrong paths count", wrongPathsCount, 0);
+    Expect(test, "has the reached pairs", (reachedPairsCount > 0) ? 1 : 0, 1);
+}
+
+// the first door cell of the map
+static CellIndex FindDoor(const Map& map)
+{
+    for (CellIndex::value_t i = 1; i + 1 < map.GetRowsCount(); i++)
+    {
+        for (CellIndex::value_t j = 0; j < map.GetColumnsCount(); j++)
+        {
+            if (map.GetCell(i, j) == MapCellType::Door)
+                return CellIndex(i, j);
+        }
+    }
+
+    throw std::runtime_error("the map hasn't the door");
+}
+
+// the field distance of every cell is the path length of the cells walk from the cell to the target,
+// the targets are around the door and at the tunnel exits, so the one-way door and the tunnel link are on the paths
+static void TestDistanceFields()
+{
+    const char* test = "DistanceField";
+    const Map& map = GetGame().GetMap();
+
+    const CellIndex door = FindDoor(map);
+    const CellIndex aboveDoor(GetRow(door) - 1, GetColumn(door));
+    const CellIndex belowDoor(GetRow(door) + 1, GetColumn(door));
+    const CellIndex targets[] = { aboveDoor, belowDoor, map.GetLeftTunnelExit(), map.GetRightTunnelExit() };
+
+    std::vector<std::unique_ptr<DistanceField>> fields;
+    for (const CellIndex& target : targets)
+    {
+        fields.push_back(std::unique_ptr<DistanceField>(new DistanceField(map)));
+        fields.back()->Build(target);
+    }
+
+    size_t wrongDistancesCount = 0;
+    for (CellIndex::value_t i = 0; i < map.GetRowsCount(); i++)
+    {
+        for (CellIndex::value_t j = 0; j < map.GetColumnsCount(); j++)
+        {
+            const CellIndex cell(i, j);
+            if ((map.GetCell(cell) != MapCellType::Empty) && (map.GetCell(cell) != MapCellType::Door))
+                continue;
+
+            const std::vector<uint32_t> distances = FindDistances(map, cell);
+            for (const std::unique_ptr<DistanceField>& field : fields)
+            {
+                if (field->GetDistance(cell) != distances[GetCellOffset(map, field->GetTarget())])
+                    wrongDistancesCount++;
+            }
+        }
+    }
+
+    Expect(test, "wrong distances count", wrongDistancesCount, 0);
+    Expect(test, "the distance up through the door", fields[0]->GetDistance(belowDoor), 2);
+    Expect(test, "the cell below the door is unreachable from the cell above it", (fields[1]->GetDistance(aboveDoor) == DistanceField::kUnreachable) ? 1 : 0, 1);
+    Expect(test, "the distance from the right tunnel exit to the left one", fields[2]->GetDistance(map.GetRightTunnelExit()), 1);
+    Expect(test, "the distance from the left tunnel exit to the right one", fields[3]->GetDistance(map.GetLeftTunnelExit()), 1);
+}
+
+size_t RunGameTests()
+{
+    gFailuresCount = 0;
+
+    TestMoveTargets();
+    TestDoorEdges();
+    TestTunnelEdges();
+    TestFindPath();
+    TestDistanceFields();
+
+    std::printf("Game tests: %u failed\n", static_cast<unsigned>(gFailuresCount));
+    return gFailuresCount;
+}
+
+} // Tools namespace
+} // Pacman namespace
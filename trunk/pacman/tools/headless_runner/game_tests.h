@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Pacman {
+namespace Tools {
+
+// checks the navigation graph and the distance fields of the loaded map against the plain cell walks and searches,
+// the failed checks are printed, returns the failures count
+// the engine should be started (the game map is loaded)
+size_t RunGameTests();
+
+} // Tools namespace
+} // Pacman namespace
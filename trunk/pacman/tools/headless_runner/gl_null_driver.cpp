@@ -0,0 +1,361 @@
+// GLES2 driver which draws nothing, the headless runner links it instead of libGLESv2.
+// The framebuffer binds, the scissor, the clears and the draws can be recorded for the renderer tests.
+//
+// Objects get the increasing names, the shaders always compile and link. The program reports
+// the attributes and the uniforms which are declared by its shaders sources, so the ShaderProgram
+// resolves the same handles as with the real driver.
+
+#include "gl_null_driver.h"
+
+#include <EGL/egl.h>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <unordered_map>
+
+namespace Pacman {
+namespace Tools {
+
+struct NullProgram
+{
+    std::vector<GLuint>      mShaders;
+    std::vector<std::string> mAttributes;
+    std::vector<std::string> mUniforms;
+};
+
+static GLuint gLastName = 0;
+static bool gRecording = false;
+static std::vector<GLCall> gRecordedCalls;
+static std::unordered_map<GLuint, std::string> gShadersSources;
+static std::unordered_map<GLuint, NullProgram> gPrograms;
+
+static void Record(const GLCallType type, const GLint arg0, const GLint arg1 = 0, const GLint arg2 = 0, const GLint arg3 = 0)
+{
+    if (gRecording)
+        gRecordedCalls.push_back({ type, { arg0, arg1, arg2, arg3 } });
+}
+
+static GLuint GenName()
+{
+    return ++gLastName;
+}
+
+static void GenNames(const GLsizei n, GLuint* names)
+{
+    for (GLsizei i = 0; i < n; i++)
+        names[i] = GenName();
+}
+
+// collects the names of the "attribute <type> <name>;" and "uniform <precision> <type> <name>[N];" declarations
+static void CollectDeclarations(const std::string& source, NullProgram& program)
+{
+    std::istringstream lines(source);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        const size_t commentPos = line.find("//");
+        if (commentPos != std::string::npos)
+            line.erase(commentPos);
+
+        const size_t endPos = line.find_first_of(";[");
+        if (endPos == std::string::npos)
+            continue;
+
+        std::istringstream tokens(line.substr(0, endPos));
+        std::string qualifier;
+        std::string name;
+        tokens >> qualifier;
+        for (std::string token; tokens >> token;)
+            name = token;
+
+        std::vector<std::string>* names = nullptr;
+        if (qualifier == "attribute")
+            names = &program.mAttributes;
+        else if (qualifier == "uniform")
+            names = &program.mUniforms;
+
+        if ((names != nullptr) && !name.empty() && (std::find(names->begin(), names->end(), name) == names->end()))
+            names->push_back(name);
+    }
+}
+
+static GLint FindName(const std::vector<std::string>& names, const GLchar* name)
+{
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        if (names[i] == name)
+            return static_cast<GLint>(i);
+    }
+
+    return -1;
+}
+
+static GLint GetMaxLength(const std::vector<std::string>& names)
+{
+    size_t maxLength = 0;
+    for (const std::string& name : names)
+        maxLength = std::max(maxLength, name.size() + 1);
+
+    return static_cast<GLint>(maxLength);
+}
+
+static void GetActiveVariable(const std::vector<std::string>& names, const GLuint index, const GLsizei bufSize,
+                              GLsizei* length, GLint* size, GLenum* type, GLchar* name)
+{
+    const std::string& variable = names.at(index);
+    const size_t copySize = std::min(variable.size(), static_cast<size_t>(std::max(bufSize - 1, 0)));
+    if (bufSize > 0)
+    {
+        std::memcpy(name, variable.c_str(), copySize);
+        name[copySize] = '\0';
+    }
+
+    if (length != nullptr)
+        *length = static_cast<GLsizei>(copySize);
+
+    *size = 1;
+    *type = GL_FLOAT;
+}
+
+void StartGLRecording()
+{
+    gRecordedCalls.clear();
+    gRecording = true;
+}
+
+void StopGLRecording()
+{
+    gRecording = false;
+}
+
+const std::vector<GLCall>& GetRecordedGLCalls()
+{
+    return gRecordedCalls;
+}
+
+} // Tools namespace
+} // Pacman namespace
+
+using namespace Pacman::Tools;
+
+extern "C" {
+
+void glActiveTexture(GLenum) {}
+void glBindBuffer(GLenum, GLuint) {}
+void glBindTexture(GLenum, GLuint) {}
+void glBlendFunc(GLenum, GLenum) {}
+void glBufferData(GLenum, GLsizeiptr, const void*, GLenum) {}
+void glBufferSubData(GLenum, GLintptr, GLsizeiptr, const void*) {}
+void glClearColor(GLfloat, GLfloat, GLfloat, GLfloat) {}
+void glCompileShader(GLuint) {}
+void glCompressedTexImage2D(GLenum, GLint, GLenum, GLsizei, GLsizei, GLint, GLsizei, const void*) {}
+void glDeleteBuffers(GLsizei, const GLuint*) {}
+void glDeleteFramebuffers(GLsizei, const GLuint*) {}
+void glDeleteTextures(GLsizei, const GLuint*) {}
+void glDisableVertexAttribArray(GLuint) {}
+void glEnableVertexAttribArray(GLuint) {}
+void glFramebufferTexture2D(GLenum, GLenum, GLenum, GLuint, GLint) {}
+void glTexImage2D(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void*) {}
+void glTexParameteri(GLenum, GLenum, GLint) {}
+void glUniform1f(GLint, GLfloat) {}
+void glUniform1i(GLint, GLint) {}
+void glUniform2fv(GLint, GLsizei, const GLfloat*) {}
+void glUniform2iv(GLint, GLsizei, const GLint*) {}
+void glUniform3fv(GLint, GLsizei, const GLfloat*) {}
+void glUniform3iv(GLint, GLsizei, const GLint*) {}
+void glUniform4fv(GLint, GLsizei, const GLfloat*) {}
+void glUniform4iv(GLint, GLsizei, const GLint*) {}
+void glUniformMatrix4fv(GLint, GLsizei, GLboolean, const GLfloat*) {}
+void glUseProgram(GLuint) {}
+void glVertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*) {}
+void glViewport(GLint, GLint, GLsizei, GLsizei) {}
+
+void glBindFramebuffer(GLenum, GLuint framebuffer)
+{
+    Record(GLCallType::BindFramebuffer, static_cast<GLint>(framebuffer));
+}
+
+void glEnable(GLenum cap)
+{
+    Record(GLCallType::Enable, static_cast<GLint>(cap));
+}
+
+void glDisable(GLenum cap)
+{
+    Record(GLCallType::Disable, static_cast<GLint>(cap));
+}
+
+void glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    Record(GLCallType::Scissor, x, y, width, height);
+}
+
+void glClear(GLbitfield mask)
+{
+    Record(GLCallType::Clear, static_cast<GLint>(mask));
+}
+
+void glDrawElements(GLenum, GLsizei count, GLenum, const void* indices)
+{
+    Record(GLCallType::DrawElements, count, static_cast<GLint>(reinterpret_cast<size_t>(indices)));
+}
+
+void glGenBuffers(GLsizei n, GLuint* buffers)
+{
+    GenNames(n, buffers);
+}
+
+void glGenFramebuffers(GLsizei n, GLuint* framebuffers)
+{
+    GenNames(n, framebuffers);
+}
+
+void glGenTextures(GLsizei n, GLuint* textures)
+{
+    GenNames(n, textures);
+}
+
+GLuint glCreateShader(GLenum)
+{
+    const GLuint shader = GenName();
+    gShadersSources[shader];
+    return shader;
+}
+
+void glDeleteShader(GLuint shader)
+{
+    gShadersSources.erase(shader);
+}
+
+void glShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length)
+{
+    std::string& source = gShadersSources[shader];
+    source.clear();
+    for (GLsizei i = 0; i < count; i++)
+    {
+        if ((length != nullptr) && (length[i] >= 0))
+            source.append(string[i], length[i]);
+        else
+            source.append(string[i]);
+    }
+}
+
+void glGetShaderiv(GLuint, GLenum pname, GLint* params)
+{
+    *params = (pname == GL_COMPILE_STATUS) ? GL_TRUE : 0;
+}
+
+void glGetShaderInfoLog(GLuint, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+{
+    if (bufSize > 0)
+        infoLog[0] = '\0';
+    if (length != nullptr)
+        *length = 0;
+}
+
+GLuint glCreateProgram()
+{
+    const GLuint program = GenName();
+    gPrograms[program];
+    return program;
+}
+
+void glDeleteProgram(GLuint program)
+{
+    gPrograms.erase(program);
+}
+
+void glAttachShader(GLuint program, GLuint shader)
+{
+    gPrograms[program].mShaders.push_back(shader);
+}
+
+void glLinkProgram(GLuint program)
+{
+    NullProgram& nullProgram = gPrograms[program];
+    nullProgram.mAttributes.clear();
+    nullProgram.mUniforms.clear();
+    for (const GLuint shader : nullProgram.mShaders)
+        CollectDeclarations(gShadersSources[shader], nullProgram);
+}
+
+void glGetProgramiv(GLuint program, GLenum pname, GLint* params)
+{
+    const NullProgram& nullProgram = gPrograms[program];
+    switch (pname)
+    {
+    case GL_LINK_STATUS:
+        *params = GL_TRUE;
+        break;
+    case GL_ACTIVE_ATTRIBUTES:
+        *params = static_cast<GLint>(nullProgram.mAttributes.size());
+        break;
+    case GL_ACTIVE_UNIFORMS:
+        *params = static_cast<GLint>(nullProgram.mUniforms.size());
+        break;
+    case GL_ACTIVE_ATTRIBUTE_MAX_LENGTH:
+        *params = GetMaxLength(nullProgram.mAttributes);
+        break;
+    case GL_ACTIVE_UNIFORM_MAX_LENGTH:
+        *params = GetMaxLength(nullProgram.mUniforms);
+        break;
+    default:
+        *params = 0;
+        break;
+    }
+}
+
+void glGetProgramInfoLog(GLuint, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+{
+    glGetShaderInfoLog(0, bufSize, length, infoLog);
+}
+
+void glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name)
+{
+    GetActiveVariable(gPrograms[program].mAttributes, index, bufSize, length, size, type, name);
+}
+
+void glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name)
+{
+    GetActiveVariable(gPrograms[program].mUniforms, index, bufSize, length, size, type, name);
+}
+
+GLint glGetAttribLocation(GLuint program, const GLchar* name)
+{
+    return FindName(gPrograms[program].mAttributes, name);
+}
+
+GLint glGetUniformLocation(GLuint program, const GLchar* name)
+{
+    return FindName(gPrograms[program].mUniforms, name);
+}
+
+GLenum glCheckFramebufferStatus(GLenum)
+{
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+GLenum glGetError()
+{
+    return GL_NO_ERROR;
+}
+
+void glGetIntegerv(GLenum, GLint* data)
+{
+    *data = 0;
+}
+
+const GLubyte* glGetString(GLenum)
+{
+    return reinterpret_cast<const GLubyte*>("");
+}
+
+// no extensions, the vertex array objects aren't used
+__eglMustCastToProperFunctionPointerType eglGetProcAddress(const char*)
+{
+    return nullptr;
+}
+
+} // extern "C"
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <GLES2/gl2.h>
+#include <vector>
+
+namespace Pacman {
+namespace Tools {
+
+// the calls of the null driver which are recorded for the renderer tests
+enum class GLCallType
+{
+    BindFramebuffer, // framebuffer
+    Enable,          // capability
+    Disable,         // capability
+    Scissor,         // x, y, width, height
+    Clear,           // mask
+    DrawElements     // count, offset
+};
+
+struct GLCall
+{
+    GLCallType mType;
+    GLint      mArgs[4];
+};
+
+// the calls are recorded until the stop, the recording is off by default (the runner steps shouldn't allocate)
+void StartGLRecording();
+
+void StopGLRecording();
+
+const std::vector<GLCall>& GetRecordedGLCalls();
+
+} // Tools namespace
+} // Pacman namespace
@@ -0,0 +1,239 @@
+// Runs the game simulation without the device: the engine is built with PACMAN_HEADLESS (no JNI, the assets
+// are read from the directory) and linked with the null GL driver, so the drawables are created but never drawn.
+// The time doesn't depend on the clock, every step advances the game by the configured simulation step, so
+// the run with the same options is repeated exactly. The steps are made as fast as the CPU allows, the game
+// is restarted when it's over.
+//
+// usage: headless_runner [options]
+//     --assets <dir>         - assets directory (../../assets by default)
+//     --steps <count>        - simulation steps count (10000 by default)
+//     --swipe-interval <n>   - the scripted swipe is made every n steps, 0 disables the input (60 by default)
+//     --seed <value>         - seed of the swipes directions (1 by default)
+//     --width <pixels>       - screen size, selects the assets multiplier (240x320 by default)
+//     --height <pixels>
+//
+// the actors positions are unsigned, the map needs a margin on the left for the tunnel, so the default
+// screen is a bit larger than the 224x288 base resolution (as any device screen)
+//     --check-allocations    - fail if the steps allocate after the warm-up, the game over step isn't checked
+//                              (requires PACMAN_ALLOCATION_TRACKING)
+//     --warmup <count>       - steps of every game which aren't checked (60 by default)
+//     --benchmark-fields <n> - don't run the game, benchmark the ghost decisions and the distance fields updates
+//                              on the generated mazes from 32x32 up to nxn (uses --seed)
+//     --benchmark-instances <n> - don't run the game, benchmark the erase and the show of n InstancedSprite
+//                              instances (up to 16383) against the linear erase, the dots use 10000 (uses --seed)
+//     --run-tests            - don't run the game, check the renderer GL calls against the recording GL stand-ins
+//                              and the map navigation against the plain cell searches, fails if any check fails
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <random>
+#include <string>
+#include <iostream>
+#include <stdexcept>
+
+#include "engine.h"
+#include "asset_manager.h"
+#include "input_manager.h"
+#include "allocation_tracker.h"
+#include "fields_benchmark.h"
+#include "instances_benchmark.h"
+#include "render_tests.h"
+#include "game_tests.h"
+
+namespace Pacman {
+
+static Engine gEngine;
+
+Engine& GetEngine()
+{
+    return gEngine;
+}
+
+namespace Tools {
+
+struct RunnerOptions
+{
+    std::string mAssetsDirectory;
+    size_t      mStepsCount;
+    size_t      mSwipeInterval;
+    uint32_t    mSeed;
+    size_t      mScreenWidth;
+    size_t      mScreenHeight;
+    bool        mCheckAllocations;
+    size_t      mWarmupStepsCount;
+    size_t      mBenchmarkFieldsSize; // 0 - the game is run
+    size_t      mBenchmarkInstancesCount; // 0 - the game is run
+    bool        mRunTests;
+};
+
+// swipe length in pixels, the gesture is recognized by the direction only
+static const float kSwipeLength = 32.0f;
+
+static size_t ParseSize(const char* value)
+{
+    char* end = nullptr;
+    const unsigned long result = std::strtoul(value, &end, 10);
+    if ((end == value) || (*end != '\0'))
+        throw std::runtime_error(std::string("wrong number ") + value);
+
+    return static_cast<size_t>(result);
+}
+
+static RunnerOptions ParseOptions(int argc, char** argv)
+{
+    RunnerOptions options = { "../../assets", 10000, 60, 1, 240, 320, false, 60, 0, 0, false };
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string option = argv[i];
+        if (option == "--check-allocations")
+        {
+            options.mCheckAllocations = true;
+            continue;
+        }
+
+        if (option == "--run-tests")
+        {
+            options.mRunTests = true;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+            throw std::runtime_error("missing value of " + option);
+
+        const char* value = argv[++i];
+        if (option == "--assets")
+            options.mAssetsDirectory = value;
+        else if (option == "--steps")
+            options.mStepsCount = ParseSize(value);
+        else if (option == "--swipe-interval")
+            options.mSwipeInterval = ParseSize(value);
+        else if (option == "--seed")
+            options.mSeed = static_cast<uint32_t>(ParseSize(value));
+        else if (option == "--width")
+            options.mScreenWidth = ParseSize(value);
+        else if (option == "--height")
+            options.mScreenHeight = ParseSize(value);
+        else if (option == "--warmup")
+            options.mWarmupStepsCount = ParseSize(value);
+        else if (option == "--benchmark-fields")
+            options.mBenchmarkFieldsSize = ParseSize(value);
+        else if (option == "--benchmark-instances")
+            options.mBenchmarkInstancesCount = ParseSize(value);
+        else
+            throw std::runtime_error("unknown option " + option);
+    }
+
+    return options;
+}
+
+// the touches of the swipe are pushed before the step, the InputManager turns them into the gesture on update
+static void Swipe(Engine& engine, const size_t direction, const float centerX, const float centerY)
+{
+    static const float kDirections[4][2] = { { 1.0f, 0.0f }, { -1.0f, 0.0f }, { 0.0f, 1.0f }, { 0.0f, -1.0f } };
+
+    const float endX = centerX + kDirections[direction][0] * kSwipeLength;
+    const float endY = centerY + kDirections[direction][1] * kSwipeLength;
+    engine.OnTouch(static_cast<int>(TouchEvent::Down), centerX, centerY);
+    engine.OnTouch(static_cast<int>(TouchEvent::Move), endX, endY);
+    engine.OnTouch(static_cast<int>(TouchEvent::Up), endX, endY);
+}
+
+static int Run(const RunnerOptions& options)
+{
+#ifndef PACMAN_ALLOCATION_TRACKING
+    if (options.mCheckAllocations)
+        throw std::runtime_error("the runner is built without PACMAN_ALLOCATION_TRACKING");
+#endif
+
+    AssetManager::SetAssetsDirectory(options.mAssetsDirectory);
+
+    Engine& engine = GetEngine();
+    engine.Start(options.mScreenWidth, options.mScreenHeight);
+
+    if (options.mBenchmarkFieldsSize > 0)
+    {
+        RunFieldsBenchmark(options.mBenchmarkFieldsSize, options.mSeed);
+        return 0;
+    }
+
+    if (options.mBenchmarkInstancesCount > 0)
+    {
+        RunInstancesBenchmark(options.mBenchmarkInstancesCount, options.mSeed);
+        return 0;
+    }
+
+    if (options.mRunTests)
+    {
+        const size_t failuresCount = RunRenderTests() + RunGameTests();
+        return (failuresCount > 0) ? 1 : 0;
+    }
+
+    std::minstd_rand random(options.mSeed);
+    const float centerX = static_cast<float>(options.mScreenWidth) / 2.0f;
+    const float centerY = static_cast<float>(options.mScreenHeight) / 2.0f;
+
+    uint64_t checkedAllocations = 0;
+#ifdef PACMAN_ALLOCATION_TRACKING
+    uint64_t checkedBytes = 0;
+#endif
+    size_t gamesCount = 1;
+    size_t gameStep = 0; // since the game start
+    const auto startTime = std::chrono::steady_clock::now();
+    for (size_t step = 0; step < options.mStepsCount; step++, gameStep++)
+    {
+        if (engine.IsTerminated())
+        {
+            engine.Start(options.mScreenWidth, options.mScreenHeight);
+            gamesCount++;
+            gameStep = 0;
+        }
+
+        if ((options.mSwipeInterval > 0) && ((step % options.mSwipeInterval) == 0))
+            Swipe(engine, random() % 4, centerX, centerY);
+
+        engine.SimulateStep();
+
+#ifdef PACMAN_ALLOCATION_TRACKING
+        // the game over step shows the info, it isn't the steady state
+        const AllocationCounters allocations = AllocationTracker::EndFrame();
+        if ((gameStep >= options.mWarmupStepsCount) && !engine.IsTerminated() && (allocations.mCount > 0))
+        {
+            checkedAllocations += allocations.mCount;
+            checkedBytes += allocations.mBytes;
+            std::printf("Step %u allocations: %llu (%llu bytes)\n", static_cast<unsigned>(step),
+                        static_cast<unsigned long long>(allocations.mCount), static_cast<unsigned long long>(allocations.mBytes));
+        }
+#endif
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    std::printf("%u steps (%u games) in %.3f s, %.0f steps/s\n", static_cast<unsigned>(options.mStepsCount),
+                static_cast<unsigned>(gamesCount), seconds,
+                (seconds > 0.0) ? (static_cast<double>(options.mStepsCount) / seconds) : 0.0);
+
+#ifdef PACMAN_ALLOCATION_TRACKING
+    AllocationTracker::Log();
+    std::printf("Allocations after the warm-up: %llu (%llu bytes)\n", static_cast<unsigned long long>(checkedAllocations),
+                static_cast<unsigned long long>(checkedBytes));
+#endif
+
+    return (options.mCheckAllocations && (checkedAllocations > 0)) ? 1 : 0;
+}
+
+} // Tools namespace
+} // Pacman namespace
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        return Pacman::Tools::Run(Pacman::Tools::ParseOptions(argc, argv));
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "error: " << e.what() << std::endl;
+        return 1;
+    }
+}
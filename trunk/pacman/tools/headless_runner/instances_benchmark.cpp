@@ -0,0 +1,136 @@
+#include "instances_benchmark.h"
+
+#include <cstdio>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+
+#include "instanced_sprite.h"
+#include "vertex_buffer.h"
+#include "color.h"
+
+namespace Pacman {
+namespace Tools {
+
+static const size_t kMaxInstancesCount = 16383; // 4 vertices of every instance are addressed by uint16_t
+static const size_t kRoundsCount = 20;          // of the constant time operations
+static const Size   kInstanceSize = 4;
+
+typedef std::chrono::steady_clock Clock;
+
+static double GetSeconds(const Clock::time_point& start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// the instances grid, as the dots of the map
+static std::vector<Position> MakeInstances(const size_t instancesCount)
+{
+    static const size_t kColumnsCount = 128;
+
+    std::vector<Position> instances;
+    instances.reserve(instancesCount);
+    for (size_t i = 0; i < instancesCount; i++)
+    {
+        instances.push_back(Position(static_cast<Size>((i % kColumnsCount) * kInstanceSize),
+                                     static_cast<Size>((i / kColumnsCount) * kInstanceSize)));
+    }
+
+    return instances;
+}
+
+// the shader program isn't used until the sprite is drawn
+static std::unique_ptr<InstancedSprite> MakeSprite(const std::vector<Position>& instances)
+{
+    const SpriteRegion region(0, 0, kInstanceSize, kInstanceSize);
+    return std::unique_ptr<InstancedSprite>(new InstancedSprite(region, Color::kWhite, Color::kWhite, Color::kWhite, Color::kWhite,
+                                                                nullptr, false, instances, true));
+}
+
+// the erase made before the constant time one: the erased instances before the index are counted
+// and the instance indices are removed from the middle of the index data, the whole data is uploaded
+static void LinearEraseInstance(VertexBuffer& vertexBuffer, std::vector<bool>& erasedInstances, const size_t index)
+{
+    static const size_t kSpriteIndexCount = 6;
+
+    std::vector<uint16_t>& indexData = vertexBuffer.LockIndexData();
+
+    size_t removedSize = 0;
+    for (size_t i = 0; i < index; i++)
+    {
+        if (erasedInstances[i])
+            removedSize += kSpriteIndexCount;
+    }
+
+    const size_t instanceOffset = (index * kSpriteIndexCount) - removedSize;
+    indexData.erase(indexData.begin() + instanceOffset, indexData.begin() + instanceOffset + kSpriteIndexCount);
+
+    vertexBuffer.UnlockIndexData();
+    erasedInstances[index] = true;
+}
+
+void RunInstancesBenchmark(const size_t instancesCount, const uint32_t seed)
+{
+    if ((instancesCount == 0) || (instancesCount > kMaxInstancesCount))
+        throw std::runtime_error("the benchmark instances count should be in [1, 16383]");
+
+    std::minstd_rand random(seed);
+    const std::vector<Position> instances = MakeInstances(instancesCount);
+    std::vector<size_t> order(instancesCount);
+    for (size_t i = 0; i < instancesCount; i++)
+        order[i] = i;
+
+    // the linear erase is quadratic over all the instances, so it's made once
+    std::shuffle(order.begin(), order.end(), random);
+    std::unique_ptr<InstancedSprite> linearSprite = MakeSprite(instances);
+    std::vector<bool> erasedInstances(instancesCount, false);
+    const Clock::time_point linearStart = Clock::now();
+    for (const size_t index : order)
+        LinearEraseInstance(*linearSprite->GetVertexBuffer(), erasedInstances, index);
+    const double linearSeconds = GetSeconds(linearStart);
+
+    std::unique_ptr<InstancedSprite> sprite = MakeSprite(instances);
+    double eraseSeconds = 0.0;
+    double showSeconds = 0.0;
+    double showAllSeconds = 0.0;
+    for (size_t round = 0; round < kRoundsCount; round++)
+    {
+        std::shuffle(order.begin(), order.end(), random);
+        const Clock::time_point eraseStart = Clock::now();
+        for (const size_t index : order)
+            sprite->EraseInstance(index);
+        eraseSeconds += GetSeconds(eraseStart);
+
+        std::shuffle(order.begin(), order.end(), random);
+        const Clock::time_point showStart = Clock::now();
+        for (const size_t index : order)
+            sprite->ShowInstance(index);
+        showSeconds += GetSeconds(showStart);
+
+        // the level restart
+        for (const size_t index : order)
+            sprite->EraseInstance(index);
+
+        const Clock::time_point showAllStart = Clock::now();
+        sprite->ShowAllInstances();
+        showAllSeconds += GetSeconds(showAllStart);
+    }
+
+    // the restart before the re-show: the sprite was created again
+    const Clock::time_point rebuildStart = Clock::now();
+    for (size_t round = 0; round < kRoundsCount; round++)
+        sprite = MakeSprite(instances);
+    const double rebuildSeconds = GetSeconds(rebuildStart);
+
+    const double operationsCount = static_cast<double>(instancesCount * kRoundsCount);
+    std::printf("%u instances | erase: linear %9.1f ns, swap %6.1f ns | show %6.1f ns | restart: show all %8.1f us, rebuild %8.1f us\n",
+                static_cast<unsigned>(instancesCount),
+                (linearSeconds * 1e9) / instancesCount, (eraseSeconds * 1e9) / operationsCount, (showSeconds * 1e9) / operationsCount,
+                (showAllSeconds * 1e6) / kRoundsCount, (rebuildSeconds * 1e6) / kRoundsCount);
+}
+
+} // Tools namespace
+} // Pacman namespace
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Pacman {
+namespace Tools {
+
+// compares the cost of the InstancedSprite instance erase (the swap with the last visible instance) with the
+// linear erase from the middle of the index data it has replaced, and the cost of the instances re-show
+// against the sprite rebuild, the instances are erased and shown in the random order
+// the engine should be started (the vertex buffers are created by its context)
+void RunInstancesBenchmark(const size_t instancesCount, const uint32_t seed);
+
+} // Tools namespace
+} // Pacman namespace
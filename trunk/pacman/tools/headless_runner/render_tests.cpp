@@ -0,0 +1,410 @@
+#include "render_tests.h"
+
+#include <GLES2/gl2.h>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "gl_null_driver.h"
+#include "engine.h"
+#include "renderer.h"
+#include "render_snapshot.h"
+#include "scene_manager.h"
+#include "vertex_buffer.h"
+#include "instanced_sprite.h"
+#include "color.h"
+#include "vertex_layout_cache.h"
+#include "game/game.h"
+#include "game/map.h"
+#include "game/dots_grid.h"
+
+namespace Pacman {
+namespace Tools {
+
+// the layout calls of the VertexLayoutCache, the vertex array objects get the increasing names
+struct LayoutCalls
+{
+    size_t mBindBuffer;
+    size_t mEnableAttribute;
+    size_t mDisableAttribute;
+    size_t mAttributePointer;
+    size_t mGenVertexArrays;
+    size_t mBindVertexArray;
+    size_t mDeleteVertexArrays;
+};
+
+static LayoutCalls gLayoutCalls = {};
+static GLuint gLastVertexArray = 0;
+static size_t gFailuresCount = 0;
+
+static void Expect(const char* test, const char* value, const size_t actual, const size_t expected)
+{
+    if (actual == expected)
+        return;
+
+    std::printf("FAILED %s: %s is %u, expected %u\n", test, value, static_cast<unsigned>(actual), static_cast<unsigned>(expected));
+    gFailuresCount++;
+}
+
+static void ExpectLayoutCalls(const char* test, const LayoutCalls& expected)
+{
+    Expect(test, "glBindBuffer", gLayoutCalls.mBindBuffer, expected.mBindBuffer);
+    Expect(test, "glEnableVertexAttribArray", gLayoutCalls.mEnableAttribute, expected.mEnableAttribute);
+    Expect(test, "glDisableVertexAttribArray", gLayoutCalls.mDisableAttribute, expected.mDisableAttribute);
+    Expect(test, "glVertexAttribPointer", gLayoutCalls.mAttributePointer, expected.mAttributePointer);
+    Expect(test, "glGenVertexArraysOES", gLayoutCalls.mGenVertexArrays, expected.mGenVertexArrays);
+    Expect(test, "glBindVertexArrayOES", gLayoutCalls.mBindVertexArray, expected.mBindVertexArray);
+    Expect(test, "glDeleteVertexArraysOES", gLayoutCalls.mDeleteVertexArrays, expected.mDeleteVertexArrays);
+    gLayoutCalls = {};
+}
+
+static void GL_APIENTRY CountBindBuffer(GLenum, GLuint)
+{
+    gLayoutCalls.mBindBuffer++;
+}
+
+static void GL_APIENTRY CountEnableAttribute(GLuint)
+{
+    gLayoutCalls.mEnableAttribute++;
+}
+
+static void GL_APIENTRY CountDisableAttribute(GLuint)
+{
+    gLayoutCalls.mDisableAttribute++;
+}
+
+static void GL_APIENTRY CountAttributePointer(GLuint, GLint, GLenum, GLboolean, GLsizei, const GLvoid*)
+{
+    gLayoutCalls.mAttributePointer++;
+}
+
+static void GL_APIENTRY CountGenVertexArrays(GLsizei count, GLuint* arrays)
+{
+    gLayoutCalls.mGenVertexArrays++;
+    for (GLsizei i = 0; i < count; i++)
+        arrays[i] = ++gLastVertexArray;
+}
+
+static void GL_APIENTRY CountBindVertexArray(GLuint)
+{
+    gLayoutCalls.mBindVertexArray++;
+}
+
+static void GL_APIENTRY CountDeleteVertexArrays(GLsizei, const GLuint*)
+{
+    gLayoutCalls.mDeleteVertexArrays++;
+}
+
+// vertexArrays - OES_vertex_array_object is supported
+static VertexLayoutApi MakeCountingApi(const bool vertexArrays)
+{
+    VertexLayoutApi api = { CountBindBuffer, CountEnableAttribute, CountDisableAttribute, CountAttributePointer,
+                            nullptr, nullptr, nullptr };
+    if (vertexArrays)
+    {
+        api.mGenVertexArrays = CountGenVertexArrays;
+        api.mBindVertexArray = CountBindVertexArray;
+        api.mDeleteVertexArrays = CountDeleteVertexArrays;
+    }
+
+    return api;
+}
+
+// two attributes buffer
+static std::unique_ptr<VertexBuffer> MakeTextureBuffer()
+{
+    const std::vector<TextureVertex> vertices = { { 0, 0, 0.0f, 0.0f }, { 0, 1, 0.0f, 1.0f }, { 1, 1, 1.0f, 1.0f } };
+    const std::vector<uint16_t> indices = { 0, 1, 2 };
+    return std::unique_ptr<VertexBuffer>(new VertexBuffer(vertices, indices, BufferUsage::Static, BufferUsage::Static));
+}
+
+// three attributes buffer
+static std::unique_ptr<VertexBuffer> MakeColorTextureBuffer()
+{
+    const std::vector<Vertex> vertices = { { 0, 0, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f }, { 0, 1, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 1.0f },
+                                           { 1, 1, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f } };
+    const std::vector<uint16_t> indices = { 0, 1, 2 };
+    return std::unique_ptr<VertexBuffer>(new VertexBuffer(vertices, indices, BufferUsage::Static, BufferUsage::Static));
+}
+
+// without the vertex array objects only the difference between the enabled arrays and the pointers is sent
+static void TestVertexLayoutDeltas()
+{
+    static const char* kTest = "vertex layout deltas";
+
+    VertexLayoutCache::Init(MakeCountingApi(false));
+    std::unique_ptr<VertexBuffer> textureBuffer = MakeTextureBuffer();
+    std::unique_ptr<VertexBuffer> colorTextureBuffer = MakeColorTextureBuffer();
+    gLayoutCalls = {};
+
+    // the creation has left the second buffer bound
+    textureBuffer->Bind();
+    ExpectLayoutCalls(kTest, { 2, 2, 0, 2, 0, 0, 0 });
+
+    for (size_t i = 0; i < 100; i++)
+        textureBuffer->Bind();
+    ExpectLayoutCalls(kTest, { 0, 0, 0, 0, 0, 0, 0 });
+
+    colorTextureBuffer->Bind();
+    ExpectLayoutCalls(kTest, { 2, 1, 0, 3, 0, 0, 0 });
+
+    textureBuffer->Bind();
+    ExpectLayoutCalls(kTest, { 2, 0, 1, 2, 0, 0, 0 });
+
+    // the pointers are kept by the disabled arrays
+    textureBuffer->Unbind();
+    ExpectLayoutCalls(kTest, { 0, 0, 2, 0, 0, 0, 0 });
+
+    textureBuffer->Bind();
+    ExpectLayoutCalls(kTest, { 0, 2, 0, 0, 0, 0, 0 });
+
+    colorTextureBuffer = nullptr;
+    textureBuffer = nullptr;
+    ExpectLayoutCalls(kTest, { 0, 0, 0, 0, 0, 0, 0 });
+}
+
+// every vertex buffer gets its own vertex array object, the next binds switch the object only
+static void TestVertexArrayObjects()
+{
+    static const char* kTest = "vertex array objects";
+
+    VertexLayoutCache::Init(MakeCountingApi(true));
+    std::unique_ptr<VertexBuffer> textureBuffer = MakeTextureBuffer();
+    std::unique_ptr<VertexBuffer> colorTextureBuffer = MakeColorTextureBuffer();
+    gLayoutCalls = {};
+
+    // the element buffer is a part of the object state, so it's bound by the setup
+    textureBuffer->Bind();
+    ExpectLayoutCalls(kTest, { 2, 2, 0, 2, 1, 1, 0 });
+
+    for (size_t i = 0; i < 100; i++)
+        textureBuffer->Bind();
+    ExpectLayoutCalls(kTest, { 0, 0, 0, 0, 0, 0, 0 });
+
+    colorTextureBuffer->Bind();
+    ExpectLayoutCalls(kTest, { 2, 3, 0, 3, 1, 1, 0 });
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        textureBuffer->Bind();
+        colorTextureBuffer->Bind();
+    }
+    ExpectLayoutCalls(kTest, { 0, 0, 0, 0, 0, 200, 0 });
+
+    textureBuffer->Unbind();
+    ExpectLayoutCalls(kTest, { 0, 0, 0, 0, 0, 1, 0 });
+
+    colorTextureBuffer = nullptr;
+    textureBuffer = nullptr;
+    ExpectLayoutCalls(kTest, { 0, 0, 0, 0, 0, 0, 2 });
+}
+
+// the calls of the static layer cache update and the frame draws
+struct FrameCalls
+{
+    size_t mFramebufferBinds;
+    size_t mScissors;
+    size_t mCacheClears; // of the bound framebuffer
+    size_t mCacheDraws;
+    size_t mFrameDraws; // of the default framebuffer
+    size_t mUnclippedCacheDraws;
+    GLint  mScissorBox[4]; // of the last glScissor
+};
+
+static FrameCalls CollectFrameCalls(const std::vector<GLCall>& calls)
+{
+    FrameCalls result = {};
+    GLint framebuffer = 0;
+    bool scissorTest = false;
+    for (const GLCall& call : calls)
+    {
+        switch (call.mType)
+        {
+        case GLCallType::BindFramebuffer:
+            result.mFramebufferBinds++;
+            framebuffer = call.mArgs[0];
+            break;
+        case GLCallType::Enable:
+        case GLCallType::Disable:
+            if (call.mArgs[0] == GL_SCISSOR_TEST)
+                scissorTest = (call.mType == GLCallType::Enable);
+            break;
+        case GLCallType::Scissor:
+            result.mScissors++;
+            std::copy(call.mArgs, call.mArgs + 4, result.mScissorBox);
+            break;
+        case GLCallType::Clear:
+            if (framebuffer != 0)
+                result.mCacheClears++;
+            break;
+        case GLCallType::DrawElements:
+            if (framebuffer == 0)
+            {
+                result.mFrameDraws++;
+            }
+            else
+            {
+                result.mCacheDraws++;
+                if (!scissorTest)
+                    result.mUnclippedCacheDraws++;
+            }
+            break;
+        }
+    }
+
+    return result;
+}
+
+// the frame of the current scene, the simulation isn't stepped, so the frames are the same
+static FrameCalls DrawRecordedFrame(RenderSnapshot& snapshot)
+{
+    Engine& engine = GetEngine();
+    engine.GetSceneManager().FillRenderNodes(snapshot.mNodes);
+
+    StartGLRecording();
+    engine.GetRenderer().DrawFrame(snapshot, 1.0f);
+    StopGLRecording();
+    return CollectFrameCalls(GetRecordedGLCalls());
+}
+
+// the draws of the actors and the HUD, the static layers are composited by a one draw
+static size_t GetDynamicDrawsCount()
+{
+    const Renderer& renderer = GetEngine().GetRenderer();
+    return renderer.GetLayerStats(RenderLayer::Actors).mDrawCallsCount + renderer.GetLayerStats(RenderLayer::HUD).mDrawCallsCount;
+}
+
+// hides the first dot of the map, returns its cell
+static CellIndex HideFirstDot()
+{
+    Map& map = GetGame().GetMap();
+    DotsGrid& dotsGrid = GetGame().GetDotsGrid();
+    const size_t eatenDotsCount = dotsGrid.GetEatenDotsCount();
+    for (CellIndex::value_t i = 0; i < map.GetRowsCount(); i++)
+    {
+        for (CellIndex::value_t j = 0; j < map.GetColumnsCount(); j++)
+        {
+            const CellIndex cell(i, j);
+            dotsGrid.HideDot(cell);
+            if (dotsGrid.GetEatenDotsCount() != eatenDotsCount)
+                return cell;
+        }
+    }
+
+    throw std::runtime_error("the map hasn't dots");
+}
+
+// the unchanged frame composites the cache only, the hidden dot redraws its cell only
+static void TestStaticLayerCache()
+{
+    static const char* kTest = "static layer cache";
+
+    Renderer& renderer = GetEngine().GetRenderer();
+    renderer.SetStaticLayerCaching(true);
+    RenderSnapshot snapshot = {};
+
+    // the first frame draws the whole cache
+    const FrameCalls firstFrame = DrawRecordedFrame(snapshot);
+    Expect(kTest, "first frame scissor width", static_cast<size_t>(firstFrame.mScissorBox[2]), renderer.GetViewportWidth());
+    Expect(kTest, "first frame scissor height", static_cast<size_t>(firstFrame.mScissorBox[3]), renderer.GetViewportHeight());
+
+    const FrameCalls unchangedFrame = DrawRecordedFrame(snapshot);
+    Expect(kTest, "unchanged frame framebuffer binds", unchangedFrame.mFramebufferBinds, 0);
+    Expect(kTest, "unchanged frame scissors", unchangedFrame.mScissors, 0);
+    Expect(kTest, "unchanged frame cache draws", unchangedFrame.mCacheDraws, 0);
+    Expect(kTest, "unchanged frame draws", unchangedFrame.mFrameDraws, 1 + GetDynamicDrawsCount());
+    Expect(kTest, "unchanged frame background draws", renderer.GetLayerStats(RenderLayer::Background).mDrawCallsCount, 1);
+    Expect(kTest, "unchanged frame pickups draws", renderer.GetLayerStats(RenderLayer::Pickups).mDrawCallsCount, 0);
+
+    // the scissor box starts at the left bottom corner
+    const CellIndex dotCell = HideFirstDot();
+    const Map& map = GetGame().GetMap();
+    const Size cellSize = map.GetCellSize();
+    const Position cellPosition = map.GetCellCenterPos(dotCell) - Position(cellSize / 2, cellSize / 2);
+    const size_t cellBottom = renderer.GetViewportHeight() - (cellPosition.GetY() + cellSize);
+
+    const FrameCalls dotFrame = DrawRecordedFrame(snapshot);
+    Expect(kTest, "hidden dot framebuffer binds", dotFrame.mFramebufferBinds, 2);
+    Expect(kTest, "hidden dot scissors", dotFrame.mScissors, 1);
+    Expect(kTest, "hidden dot scissor x", static_cast<size_t>(dotFrame.mScissorBox[0]), cellPosition.GetX());
+    Expect(kTest, "hidden dot scissor y", static_cast<size_t>(dotFrame.mScissorBox[1]), cellBottom);
+    Expect(kTest, "hidden dot scissor width", static_cast<size_t>(dotFrame.mScissorBox[2]), cellSize);
+    Expect(kTest, "hidden dot scissor height", static_cast<size_t>(dotFrame.mScissorBox[3]), cellSize);
+    Expect(kTest, "hidden dot cache clears", dotFrame.mCacheClears, 1);
+    Expect(kTest, "hidden dot redraw", (dotFrame.mCacheDraws > 0) ? 1 : 0, 1);
+    Expect(kTest, "hidden dot unclipped draws", dotFrame.mUnclippedCacheDraws, 0);
+    Expect(kTest, "hidden dot frame draws", dotFrame.mFrameDraws, 1 + GetDynamicDrawsCount());
+
+    const FrameCalls nextFrame = DrawRecordedFrame(snapshot);
+    Expect(kTest, "next frame framebuffer binds", nextFrame.mFramebufferBinds, 0);
+    Expect(kTest, "next frame draws", nextFrame.mFrameDraws, 1 + GetDynamicDrawsCount());
+
+    GetGame().GetDotsGrid().ShowAllDots();
+}
+
+// the added instance copies the vertices of the first one to its position and takes the slot after the visible ones
+static void TestInstanceAdd()
+{
+    static const char* kTest = "instance add";
+    static const Size kInstanceSize = 4;
+    static const size_t kSpriteIndexCount = 6;
+
+    const SpriteRegion region(0, 0, kInstanceSize, kInstanceSize);
+    const std::vector<Position> instances = { Position(0, 0), Position(10, 0), Position(20, 0) };
+    InstancedSprite sprite(region, Color::kWhite, Color::kWhite, Color::kWhite, Color::kWhite, nullptr, false, instances, true);
+
+    sprite.EraseInstance(0);
+    sprite.EraseInstance(1);
+    const size_t index = sprite.AddInstance(Position(30, 40));
+    Expect(kTest, "index", index, 3);
+    Expect(kTest, "instances", sprite.GetInstancesCount(), 4);
+    Expect(kTest, "visible instances", sprite.GetVisibleInstancesCount(), 2);
+    Expect(kTest, "visible", sprite.IsInstanceVisible(index) ? 1 : 0, 1);
+
+    VertexBuffer& vertexBuffer = *sprite.GetVertexBuffer();
+    Expect(kTest, "vertex count", vertexBuffer.GetVertexCount(), 16);
+    Expect(kTest, "index count", vertexBuffer.GetIndexCount(), 2 * kSpriteIndexCount);
+
+    // the quad corners in the sprite order: left top, left bottom, right bottom, right top
+    const std::vector<byte_t>& vertexData = vertexBuffer.LockVertexData();
+    const ColorVertex* vertices = reinterpret_cast<const ColorVertex*>(&vertexData.front()) + (index * 4);
+    static const Size kCorners[4][2] = { { 0, 0 }, { 0, kInstanceSize }, { kInstanceSize, kInstanceSize }, { kInstanceSize, 0 } };
+    for (size_t i = 0; i < 4; i++)
+    {
+        Expect(kTest, "vertex x", vertices[i].x, 30 + kCorners[i][0]);
+        Expect(kTest, "vertex y", vertices[i].y, 40 + kCorners[i][1]);
+    }
+    vertexBuffer.UnlockVertexData(vertexBuffer.GetVertexCount(), 0, 0);
+
+    // the slot 0 has got the last instance on the erase, the new one is the next
+    const std::vector<uint16_t>& indexData = vertexBuffer.LockIndexData();
+    Expect(kTest, "slot 0 instance", indexData[0] / 4, 2);
+    Expect(kTest, "slot 1 instance", indexData[kSpriteIndexCount] / 4, index);
+    vertexBuffer.UnlockIndexData(0, 0);
+
+    sprite.ShowInstance(0);
+    Expect(kTest, "visible instances after show", sprite.GetVisibleInstancesCount(), 3);
+    Expect(kTest, "slot 2 instance", vertexBuffer.LockIndexData()[2 * kSpriteIndexCount] / 4, 0);
+    vertexBuffer.UnlockIndexData(0, 0);
+}
+
+size_t RunRenderTests()
+{
+    gFailuresCount = 0;
+
+    TestVertexLayoutDeltas();
+    TestVertexArrayObjects();
+
+    // the tests have replaced the GL functions of the cache
+    VertexLayoutCache::Init(VertexLayoutCache::MakeDefaultApi());
+    TestStaticLayerCache();
+    TestInstanceAdd();
+
+    std::printf("Render tests: %u failed\n", static_cast<unsigned>(gFailuresCount));
+    return gFailuresCount;
+}
+
+} // Tools namespace
+} // Pacman namespace
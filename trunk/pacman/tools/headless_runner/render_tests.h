@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Pacman {
+namespace Tools {
+
+// checks the renderer parts (their GL calls against the recording stand-ins of the GL driver and their buffers data),
+// the failed checks are printed, returns the failures count
+// the engine should be started (the renderer resources are created by its context, the scene is drawn)
+size_t RunRenderTests();
+
+} // Tools namespace
+} // Pacman namespace
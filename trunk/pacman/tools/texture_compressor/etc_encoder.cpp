@@ -0,0 +1,476 @@
+#include "etc_encoder.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace Pacman {
+namespace Tools {
+
+static const size_t kBlockPixels = kEtcBlockSize * kEtcBlockSize;
+static const size_t kSubBlockPixels = kBlockPixels / 2;
+static const int kBaseColorSearchRange = 2; // the average color is shifted by [-range, range] along the gray axis
+
+// ETC1 intensity modifiers, the selector index is 0: +a, 1: +b, 2: -a, 3: -b
+static const int kEtc1Modifiers[8][2] =
+{
+    { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 }
+};
+
+static const int kEacModifiers[16][8] =
+{
+    { -3, -6,  -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5,  -8, -13, 1, 4, 7, 12 },
+    { -2, -4,  -6, -13, 1, 3, 5, 12 },
+    { -3, -6,  -8, -12, 2, 5, 7, 11 },
+    { -3, -7,  -9, -11, 2, 6, 8, 10 },
+    { -4, -7,  -8, -11, 3, 6, 7, 10 },
+    { -3, -5,  -8, -11, 2, 4, 7, 10 },
+    { -2, -6,  -8, -10, 1, 5, 7,  9 },
+    { -2, -5,  -8, -10, 1, 4, 7,  9 },
+    { -2, -4,  -8, -10, 1, 3, 7,  9 },
+    { -2, -5,  -7, -10, 1, 4, 6,  9 },
+    { -3, -4,  -7, -10, 2, 3, 6,  9 },
+    { -1, -2,  -3, -10, 0, 1, 2,  9 },
+    { -4, -6,  -8,  -9, 3, 5, 7,  8 },
+    { -3, -5,  -7,  -9, 2, 4, 6,  8 }
+};
+
+static const size_t kEacZeroModifierTable = 13; // contains the zero modifier (exact for the flat blocks)
+static const int kEacBaseSearchMargin = 2;
+
+struct Color
+{
+    int mRed, mGreen, mBlue;
+};
+
+// block pixels are stored by the columns (pixel index = x * 4 + y), it's the ETC bits order
+typedef std::array<Color, kBlockPixels> ColorBlock;
+typedef std::array<int, kBlockPixels> AlphaBlock;
+
+struct SubBlockFit
+{
+    int                                  mError;
+    size_t                               mTable;
+    std::array<uint8_t, kSubBlockPixels> mSelectors;
+};
+
+static int Clamp(const int value)
+{
+    return std::min(std::max(value, 0), 255);
+}
+
+static int Square(const int value)
+{
+    return value * value;
+}
+
+static size_t PixelIndex(const size_t x, const size_t y)
+{
+    return x * kEtcBlockSize + y;
+}
+
+static const uint8_t* GetPixel(const uint8_t* pixels, const size_t width, const size_t height, const size_t x, const size_t y)
+{
+    // the last row and column are repeated in the padding
+    const size_t clampedX = std::min(x, width - 1);
+    const size_t clampedY = std::min(y, height - 1);
+    return pixels + (clampedY * width + clampedX) * 4;
+}
+
+static ColorBlock ReadColorBlock(const uint8_t* pixels, const size_t width, const size_t height,
+                                 const size_t blockX, const size_t blockY, const EtcSource source)
+{
+    ColorBlock block;
+    for (size_t x = 0; x < kEtcBlockSize; x++)
+    {
+        for (size_t y = 0; y < kEtcBlockSize; y++)
+        {
+            const uint8_t* pixel = GetPixel(pixels, width, height, blockX + x, blockY + y);
+            block[PixelIndex(x, y)] = (source == EtcSource::Color) ? Color { pixel[0], pixel[1], pixel[2] }
+                                                                   : Color { pixel[3], pixel[3], pixel[3] };
+        }
+    }
+
+    return block;
+}
+
+static AlphaBlock ReadAlphaBlock(const uint8_t* pixels, const size_t width, const size_t height,
+                                 const size_t blockX, const size_t blockY)
+{
+    AlphaBlock block;
+    for (size_t x = 0; x < kEtcBlockSize; x++)
+    {
+        for (size_t y = 0; y < kEtcBlockSize; y++)
+        {
+            block[PixelIndex(x, y)] = GetPixel(pixels, width, height, blockX + x, blockY + y)[3];
+        }
+    }
+
+    return block;
+}
+
+//===========================================================================================================
+// ETC1
+
+// pixel indices of the sub-block, flipped sub-blocks are 4x2 (top, bottom), otherwise 2x4 (left, right)
+static std::array<size_t, kSubBlockPixels> GetSubBlockPixels(const bool flip, const size_t subBlock)
+{
+    std::array<size_t, kSubBlockPixels> result;
+    size_t count = 0;
+    for (size_t x = 0; x < kEtcBlockSize; x++)
+    {
+        for (size_t y = 0; y < kEtcBlockSize; y++)
+        {
+            const size_t coord = flip ? y : x;
+            if ((coord / 2) == subBlock)
+                result[count++] = PixelIndex(x, y);
+        }
+    }
+
+    return result;
+}
+
+static SubBlockFit FitSubBlock(const ColorBlock& block, const std::array<size_t, kSubBlockPixels>& subBlockPixels,
+                               const Color& base)
+{
+    SubBlockFit best;
+    best.mError = std::numeric_limits<int>::max();
+
+    for (size_t table = 0; table < 8; table++)
+    {
+        const int modifiers[4] = { kEtc1Modifiers[table][0], kEtc1Modifiers[table][1],
+                                   -kEtc1Modifiers[table][0], -kEtc1Modifiers[table][1] };
+
+        SubBlockFit fit;
+        fit.mError = 0;
+        fit.mTable = table;
+        for (size_t i = 0; (i < kSubBlockPixels) && (fit.mError < best.mError); i++)
+        {
+            const Color& pixel = block[subBlockPixels[i]];
+            int bestPixelError = std::numeric_limits<int>::max();
+            for (uint8_t selector = 0; selector < 4; selector++)
+            {
+                const int error = Square(Clamp(base.mRed + modifiers[selector]) - pixel.mRed) +
+                                  Square(Clamp(base.mGreen + modifiers[selector]) - pixel.mGreen) +
+                                  Square(Clamp(base.mBlue + modifiers[selector]) - pixel.mBlue);
+                if (error < bestPixelError)
+                {
+                    bestPixelError = error;
+                    fit.mSelectors[i] = selector;
+                }
+            }
+
+            fit.mError += bestPixelError;
+        }
+
+        if (fit.mError < best.mError)
+            best = fit;
+    }
+
+    return best;
+}
+
+static Color GetAverage(const ColorBlock& block, const std::array<size_t, kSubBlockPixels>& subBlockPixels)
+{
+    Color sum = { 0, 0, 0 };
+    for (const size_t index : subBlockPixels)
+    {
+        sum.mRed += block[index].mRed;
+        sum.mGreen += block[index].mGreen;
+        sum.mBlue += block[index].mBlue;
+    }
+
+    const int count = static_cast<int>(kSubBlockPixels);
+    return { (sum.mRed + count / 2) / count, (sum.mGreen + count / 2) / count, (sum.mBlue + count / 2) / count };
+}
+
+static int Quantize(const int value, const int maxValue)
+{
+    return (value * maxValue + 127) / 255;
+}
+
+static Color ExpandColor(const Color& color, const int bits)
+{
+    if (bits == 4)
+        return { (color.mRed << 4) | color.mRed, (color.mGreen << 4) | color.mGreen, (color.mBlue << 4) | color.mBlue };
+
+    return { (color.mRed << 3) | (color.mRed >> 2), (color.mGreen << 3) | (color.mGreen >> 2),
+             (color.mBlue << 3) | (color.mBlue >> 2) };
+}
+
+// quantized base color candidates of the sub-block
+static std::vector<Color> MakeBaseCandidates(const Color& average, const int bits)
+{
+    const int maxValue = (1 << bits) - 1;
+    const Color quantized = { Quantize(average.mRed, maxValue), Quantize(average.mGreen, maxValue),
+                              Quantize(average.mBlue, maxValue) };
+
+    std::vector<Color> result;
+    for (int shift = -kBaseColorSearchRange; shift <= kBaseColorSearchRange; shift++)
+    {
+        const Color candidate = { quantized.mRed + shift, quantized.mGreen + shift, quantized.mBlue + shift };
+        if (std::min({ candidate.mRed, candidate.mGreen, candidate.mBlue }) < 0 ||
+            std::max({ candidate.mRed, candidate.mGreen, candidate.mBlue }) > maxValue)
+            continue;
+
+        result.push_back(candidate);
+    }
+
+    return result;
+}
+
+struct Etc1Block
+{
+    int         mError;
+    bool        mFlip;
+    bool        mDifferential;
+    Color       mBase[2]; // quantized
+    SubBlockFit mFit[2];
+};
+
+static void WriteEtc1Block(const Etc1Block& block, uint8_t* output)
+{
+    const Color& first = block.mBase[0];
+    const Color& second = block.mBase[1];
+
+    if (block.mDifferential)
+    {
+        output[0] = static_cast<uint8_t>((first.mRed << 3) | ((second.mRed - first.mRed) & 7));
+        output[1] = static_cast<uint8_t>((first.mGreen << 3) | ((second.mGreen - first.mGreen) & 7));
+        output[2] = static_cast<uint8_t>((first.mBlue << 3) | ((second.mBlue - first.mBlue) & 7));
+    }
+    else
+    {
+        output[0] = static_cast<uint8_t>((first.mRed << 4) | second.mRed);
+        output[1] = static_cast<uint8_t>((first.mGreen << 4) | second.mGreen);
+        output[2] = static_cast<uint8_t>((first.mBlue << 4) | second.mBlue);
+    }
+
+    output[3] = static_cast<uint8_t>((block.mFit[0].mTable << 5) | (block.mFit[1].mTable << 2) |
+                                     (block.mDifferential ? 2 : 0) | (block.mFlip ? 1 : 0));
+
+    uint32_t highBits = 0;
+    uint32_t lowBits = 0;
+    for (size_t subBlock = 0; subBlock < 2; subBlock++)
+    {
+        const std::array<size_t, kSubBlockPixels> pixels = GetSubBlockPixels(block.mFlip, subBlock);
+        for (size_t i = 0; i < kSubBlockPixels; i++)
+        {
+            const uint8_t selector = block.mFit[subBlock].mSelectors[i];
+            highBits |= static_cast<uint32_t>(selector >> 1) << pixels[i];
+            lowBits |= static_cast<uint32_t>(selector & 1) << pixels[i];
+        }
+    }
+
+    output[4] = static_cast<uint8_t>(highBits >> 8);
+    output[5] = static_cast<uint8_t>(highBits);
+    output[6] = static_cast<uint8_t>(lowBits >> 8);
+    output[7] = static_cast<uint8_t>(lowBits);
+}
+
+static void EncodeEtc1Block(const ColorBlock& block, uint8_t* output)
+{
+    Etc1Block best;
+    best.mError = std::numeric_limits<int>::max();
+
+    for (int flipIndex = 0; flipIndex < 2; flipIndex++)
+    {
+        const bool flip = (flipIndex == 1);
+        const std::array<size_t, kSubBlockPixels> subBlockPixels[2] = { GetSubBlockPixels(flip, 0),
+                                                                        GetSubBlockPixels(flip, 1) };
+        const Color averages[2] = { GetAverage(block, subBlockPixels[0]), GetAverage(block, subBlockPixels[1]) };
+
+        // individual mode, the sub-blocks are independent
+        Etc1Block individual;
+        individual.mError = 0;
+        individual.mFlip = flip;
+        individual.mDifferential = false;
+        for (size_t subBlock = 0; subBlock < 2; subBlock++)
+        {
+            individual.mFit[subBlock].mError = std::numeric_limits<int>::max();
+            for (const Color& candidate : MakeBaseCandidates(averages[subBlock], 4))
+            {
+                const SubBlockFit fit = FitSubBlock(block, subBlockPixels[subBlock], ExpandColor(candidate, 4));
+                if (fit.mError < individual.mFit[subBlock].mError)
+                {
+                    individual.mFit[subBlock] = fit;
+                    individual.mBase[subBlock] = candidate;
+                }
+            }
+
+            individual.mError += individual.mFit[subBlock].mError;
+        }
+
+        if (individual.mError < best.mError)
+            best = individual;
+
+        // differential mode, the second base color is stored as a 3 bits delta [-4, 3] to the first one
+        const std::vector<Color> candidates[2] = { MakeBaseCandidates(averages[0], 5), MakeBaseCandidates(averages[1], 5) };
+        std::vector<SubBlockFit> fits[2];
+        for (size_t subBlock = 0; subBlock < 2; subBlock++)
+        {
+            for (const Color& candidate : candidates[subBlock])
+                fits[subBlock].push_back(FitSubBlock(block, subBlockPixels[subBlock], ExpandColor(candidate, 5)));
+        }
+
+        for (size_t i = 0; i < candidates[0].size(); i++)
+        {
+            for (size_t j = 0; j < candidates[1].size(); j++)
+            {
+                const Color& first = candidates[0][i];
+                const Color& second = candidates[1][j];
+                const int deltas[3] = { second.mRed - first.mRed, second.mGreen - first.mGreen, second.mBlue - first.mBlue };
+                if (std::min({ deltas[0], deltas[1], deltas[2] }) < -4 || std::max({ deltas[0], deltas[1], deltas[2] }) > 3)
+                    continue;
+
+                const int error = fits[0][i].mError + fits[1][j].mError;
+                if (error < best.mError)
+                {
+                    best.mError = error;
+                    best.mFlip = flip;
+                    best.mDifferential = true;
+                    best.mBase[0] = first;
+                    best.mBase[1] = second;
+                    best.mFit[0] = fits[0][i];
+                    best.mFit[1] = fits[1][j];
+                }
+            }
+        }
+    }
+
+    WriteEtc1Block(best, output);
+}
+
+//===========================================================================================================
+// EAC
+
+struct EacFit
+{
+    int                               mError;
+    int                               mBase;
+    int                               mMultiplier;
+    size_t                            mTable;
+    std::array<uint8_t, kBlockPixels> mIndices;
+};
+
+static void FitEac(const AlphaBlock& block, const int base, const int multiplier, const size_t table, EacFit& best)
+{
+    EacFit fit;
+    fit.mError = 0;
+    fit.mBase = base;
+    fit.mMultiplier = multiplier;
+    fit.mTable = table;
+
+    for (size_t i = 0; (i < kBlockPixels) && (fit.mError < best.mError); i++)
+    {
+        int bestPixelError = std::numeric_limits<int>::max();
+        for (uint8_t index = 0; index < 8; index++)
+        {
+            const int error = Square(Clamp(base + kEacModifiers[table][index] * multiplier) - block[i]);
+            if (error < bestPixelError)
+            {
+                bestPixelError = error;
+                fit.mIndices[i] = index;
+            }
+        }
+
+        fit.mError += bestPixelError;
+    }
+
+    if (fit.mError < best.mError)
+        best = fit;
+}
+
+static void EncodeEacBlock(const AlphaBlock& block, uint8_t* output)
+{
+    const int minAlpha = *std::min_element(block.begin(), block.end());
+    const int maxAlpha = *std::max_element(block.begin(), block.end());
+
+    EacFit best;
+    best.mError = std::numeric_limits<int>::max();
+
+    if (minAlpha == maxAlpha)
+    {
+        FitEac(block, minAlpha, 1, kEacZeroModifierTable, best);
+    }
+    else
+    {
+        // the base is searched between the values which map the block minimum to the lowest modifier
+        // and the block maximum to the highest one (with a small margin for the clamping)
+        for (size_t table = 0; (table < 16) && (best.mError > 0); table++)
+        {
+            const int minModifier = kEacModifiers[table][3];
+            const int maxModifier = kEacModifiers[table][7];
+
+            for (int multiplier = 1; multiplier <= 15; multiplier++)
+            {
+                const int lowAnchor = minAlpha - minModifier * multiplier;
+                const int highAnchor = maxAlpha - maxModifier * multiplier;
+                const int first = std::max(std::min(lowAnchor, highAnchor) - kEacBaseSearchMargin, 0);
+                const int last = std::min(std::max(lowAnchor, highAnchor) + kEacBaseSearchMargin, 255);
+
+                for (int base = first; base <= last; base++)
+                    FitEac(block, base, multiplier, table, best);
+            }
+        }
+    }
+
+    output[0] = static_cast<uint8_t>(best.mBase);
+    output[1] = static_cast<uint8_t>((best.mMultiplier << 4) | best.mTable);
+
+    uint64_t indices = 0;
+    for (size_t i = 0; i < kBlockPixels; i++)
+        indices = (indices << 3) | best.mIndices[i];
+
+    for (size_t i = 0; i < 6; i++)
+        output[2 + i] = static_cast<uint8_t>(indices >> (40 - i * 8));
+}
+
+//===========================================================================================================
+
+std::vector<uint8_t> EncodeETC1(const uint8_t* pixels, const size_t width, const size_t height, const EtcSource source)
+{
+    const size_t blocksX = (width + kEtcBlockSize - 1) / kEtcBlockSize;
+    const size_t blocksY = (height + kEtcBlockSize - 1) / kEtcBlockSize;
+
+    std::vector<uint8_t> result(blocksX * blocksY * kEtc1BlockBytes);
+    uint8_t* output = &result.front();
+    for (size_t y = 0; y < blocksY; y++)
+    {
+        for (size_t x = 0; x < blocksX; x++)
+        {
+            const ColorBlock block = ReadColorBlock(pixels, width, height, x * kEtcBlockSize, y * kEtcBlockSize, source);
+            EncodeEtc1Block(block, output);
+            output += kEtc1BlockBytes;
+        }
+    }
+
+    return result;
+}
+
+std::vector<uint8_t> EncodeETC2RGBA8(const uint8_t* pixels, const size_t width, const size_t height)
+{
+    const size_t blocksX = (width + kEtcBlockSize - 1) / kEtcBlockSize;
+    const size_t blocksY = (height + kEtcBlockSize - 1) / kEtcBlockSize;
+
+    std::vector<uint8_t> result(blocksX * blocksY * kEtc2RGBA8BlockBytes);
+    uint8_t* output = &result.front();
+    for (size_t y = 0; y < blocksY; y++)
+    {
+        for (size_t x = 0; x < blocksX; x++)
+        {
+            const size_t blockX = x * kEtcBlockSize;
+            const size_t blockY = y * kEtcBlockSize;
+            EncodeEacBlock(ReadAlphaBlock(pixels, width, height, blockX, blockY), output);
+            EncodeEtc1Block(ReadColorBlock(pixels, width, height, blockX, blockY, EtcSource::Color), output + kEtc1BlockBytes);
+            output += kEtc2RGBA8BlockBytes;
+        }
+    }
+
+    return result;
+}
+
+} // Tools namespace
+} // Pacman namespace
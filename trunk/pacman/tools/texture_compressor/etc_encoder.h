@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Pacman {
+namespace Tools {
+
+static const size_t kEtcBlockSize = 4;         // block is 4x4 pixels
+static const size_t kEtc1BlockBytes = 8;       // ETC1 / ETC2 RGB8 block
+static const size_t kEtc2RGBA8BlockBytes = 16; // EAC alpha block + ETC2 RGB8 block
+
+// channel of the RGBA8 pixel used as the source of the encoded color
+enum class EtcSource
+{
+    Color, // RGB channels
+    Alpha  // alpha channel replicated into RGB (ETC1 alpha plane)
+};
+
+// encodes the RGBA8 image into the ETC1 blocks, the image is padded by its edge pixels to the multiple of 4
+// the blocks use only the individual and the differential modes without the overflow,
+// so the output is also a valid ETC2 RGB8 data
+std::vector<uint8_t> EncodeETC1(const uint8_t* pixels, const size_t width, const size_t height, const EtcSource source);
+
+// encodes the RGBA8 image into the ETC2 RGBA8 (EAC alpha) blocks
+std::vector<uint8_t> EncodeETC2RGBA8(const uint8_t* pixels, const size_t width, const size_t height);
+
+} // Tools namespace
+} // Pacman namespace
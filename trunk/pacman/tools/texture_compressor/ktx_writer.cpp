@@ -0,0 +1,50 @@
+#include "ktx_writer.h"
+
+#include <fstream>
+#include <stdexcept>
+
+namespace Pacman {
+namespace Tools {
+
+static const uint8_t kKtxIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+static const uint32_t kKtxEndianness = 0x04030201;
+
+static void WriteUInt32(std::ofstream& file, const uint32_t value)
+{
+    const uint8_t bytes[4] = { static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8),
+                               static_cast<uint8_t>(value >> 16), static_cast<uint8_t>(value >> 24) };
+    file.write(reinterpret_cast<const char*>(bytes), sizeof(bytes));
+}
+
+void WriteKtx(const std::string& path, const uint32_t internalFormat, const uint32_t baseInternalFormat,
+              const size_t width, const size_t height, const std::vector<uint8_t>& data)
+{
+    std::ofstream file(path.c_str(), std::ios::out | std::ios::binary);
+    if (!file)
+        throw std::runtime_error("can't write " + path);
+
+    file.write(reinterpret_cast<const char*>(kKtxIdentifier), sizeof(kKtxIdentifier));
+    WriteUInt32(file, kKtxEndianness);
+    WriteUInt32(file, 0);                   // glType (compressed)
+    WriteUInt32(file, 1);                   // glTypeSize
+    WriteUInt32(file, 0);                   // glFormat (compressed)
+    WriteUInt32(file, internalFormat);
+    WriteUInt32(file, baseInternalFormat);
+    WriteUInt32(file, width);
+    WriteUInt32(file, height);
+    WriteUInt32(file, 0);                   // pixelDepth
+    WriteUInt32(file, 0);                   // numberOfArrayElements
+    WriteUInt32(file, 1);                   // numberOfFaces
+    WriteUInt32(file, 1);                   // numberOfMipmapLevels
+    WriteUInt32(file, 0);                   // bytesOfKeyValueData
+
+    // the ETC blocks are 8 or 16 bytes, so the level is always 4 bytes aligned
+    WriteUInt32(file, data.size());
+    file.write(reinterpret_cast<const char*>(&data.front()), data.size());
+
+    if (!file)
+        throw std::runtime_error("can't write " + path);
+}
+
+} // Tools namespace
+} // Pacman namespace
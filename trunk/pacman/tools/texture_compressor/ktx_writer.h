@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Pacman {
+namespace Tools {
+
+// GL internal formats of the compressed textures
+static const uint32_t kGLCompressedETC1RGB8 = 0x8D64;     // GL_ETC1_RGB8_OES
+static const uint32_t kGLCompressedRGBA8ETC2 = 0x9278;    // GL_COMPRESSED_RGBA8_ETC2_EAC
+static const uint32_t kGLBaseFormatRGB = 0x1907;          // GL_RGB
+static const uint32_t kGLBaseFormatRGBA = 0x1908;         // GL_RGBA
+
+// writes the single level KTX 1.1 file (little endian, without the key/value data)
+void WriteKtx(const std::string& path, const uint32_t internalFormat, const uint32_t baseInternalFormat,
+              const size_t width, const size_t height, const std::vector<uint8_t>& data);
+
+} // Tools namespace
+} // Pacman namespace
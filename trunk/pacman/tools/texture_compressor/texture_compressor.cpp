@@ -0,0 +1,94 @@
+// Compresses the PNG textures into the ETC formats which are preferred by the AssetManager::LoadTexture.
+//
+// usage: texture_compressor <image.png>...
+//
+// every <name>.png is written next to the source as:
+//     <name>.etc2.ktx       - ETC2 RGBA8 (EAC alpha), used if the device supports it
+//     <name>.etc1.ktx       - ETC1 RGB8, supported by every GLES2 device
+//     <name>.alpha.etc1.ktx - ETC1 alpha plane (alpha in the color channels), only for the images with the alpha
+//
+// the image size should be a multiple of 4, otherwise the last blocks are padded by the edge pixels
+
+#include <iostream>
+#include <string>
+#include <stdexcept>
+
+#include "etc_encoder.h"
+#include "ktx_writer.h"
+#include "png_image.h"
+
+namespace Pacman {
+namespace Tools {
+
+static std::string RemoveExtension(const std::string& path)
+{
+    const size_t dotPos = path.find_last_of('.');
+    if ((dotPos == std::string::npos) || (path.substr(dotPos) != ".png"))
+        throw std::runtime_error("not a png file: " + path);
+
+    return path.substr(0, dotPos);
+}
+
+static bool HasAlpha(const Image& image)
+{
+    for (size_t i = 3; i < image.mPixels.size(); i += kPixelSize)
+    {
+        if (image.mPixels[i] != 255)
+            return true;
+    }
+
+    return false;
+}
+
+static void Compress(const std::string& path)
+{
+    Image image;
+    if (!LoadImage(path, image))
+        throw std::runtime_error("can't load " + path);
+
+    if (((image.mWidth % kEtcBlockSize) != 0) || ((image.mHeight % kEtcBlockSize) != 0))
+        std::cerr << "warning: " << path << " size isn't a multiple of " << kEtcBlockSize << std::endl;
+
+    const std::string name = RemoveExtension(path);
+    const uint8_t* pixels = &image.mPixels.front();
+    const bool hasAlpha = HasAlpha(image);
+
+    WriteKtx(name + ".etc2.ktx", kGLCompressedRGBA8ETC2, kGLBaseFormatRGBA, image.mWidth, image.mHeight,
+             EncodeETC2RGBA8(pixels, image.mWidth, image.mHeight));
+
+    WriteKtx(name + ".etc1.ktx", kGLCompressedETC1RGB8, kGLBaseFormatRGB, image.mWidth, image.mHeight,
+             EncodeETC1(pixels, image.mWidth, image.mHeight, EtcSource::Color));
+
+    if (hasAlpha)
+    {
+        WriteKtx(name + ".alpha.etc1.ktx", kGLCompressedETC1RGB8, kGLBaseFormatRGB, image.mWidth, image.mHeight,
+                 EncodeETC1(pixels, image.mWidth, image.mHeight, EtcSource::Alpha));
+    }
+
+    std::cout << path << ": " << image.mWidth << "x" << image.mHeight << (hasAlpha ? ", alpha plane" : "") << std::endl;
+}
+
+} // Tools namespace
+} // Pacman namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: texture_compressor <image.png>..." << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        for (int i = 1; i < argc; i++)
+            Pacman::Tools::Compress(argv[i]);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}